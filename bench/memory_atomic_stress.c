@@ -0,0 +1,317 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Host stress test of the tear-free copies: one writer, N readers, every load checked.
+ *
+ *  @file       memory_atomic_stress.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The writer stores 1, 2, 3, ... through MEM_atomicStore64 as the pair { k, ~k }, and, where the
+ *              target has 16-byte copies, through MEM_atomicStore128 as { k, ~k, k * c, ~(k * c) }. Each reader
+ *              loops on the matching loads and checks that every value it sees is one of those patterns and
+ *              that the values never go backwards. A value that mixes two stores, or an older store after a
+ *              newer one, is counted as a tear and makes the run fail.
+ *
+ *              Ordering is checked too: before storing k the writer sets payload[k] with a plain store, and a
+ *              reader that loads k through MEM_atomicLoad64 reads payload[k] with a plain load. The value is
+ *              checked, and under ThreadSanitizer the pair of plain accesses is reported as a race unless the
+ *              store is a release and the load an acquire.
+ *
+ *              Build and run from the repository root (add -mcx16 to cover the 16-byte copies):
+ *
+ *                  gcc -O2 -std=gnu11 -pthread -Iinc -Isrc bench/memory_atomic_stress.c src/memory_atomic.c \
+ *                      -o memory_atomic_stress
+ *                  ./memory_atomic_stress [--readers n] [--stores n]
+ *
+ *              Sanitizer builds use the same line with -O1 -g and -fsanitize=address,undefined, or
+ *              -fsanitize=thread. ThreadSanitizer does not see inside the CMPXCHG16B asm, so the 16-byte copies
+ *              are only checked for tears and the payload check uses the 8-byte copies alone.
+ *
+ *  @see        - memory_atomic.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory_atomic.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def STRESS_READERS
+ * @brief Default number of reader threads.
+ **/
+#define STRESS_READERS              (4u)
+
+/**
+ * @def STRESS_MAX_READERS
+ * @brief Upper bound of --readers.
+ **/
+#define STRESS_MAX_READERS          (64u)
+
+/**
+ * @def STRESS_STORES
+ * @brief Default number of stores.
+ **/
+#define STRESS_STORES               (2000000u)
+
+/**
+ * @def STRESS_SPREAD
+ * @brief Odd multiplier that fills the upper half of the 16-byte pattern.
+ **/
+#define STRESS_SPREAD               (0x9E3779B97F4A7C15ull)
+
+/* =================================
+ *          PRIVATE TYPES          *
+ * ================================*/
+
+/**
+ * @struct stressReader
+ * @brief State and results of one reader thread.
+ **/
+typedef struct stressReader
+{
+    pthread_t thread;           /**< Reader thread */
+    uint64_t  reads;            /**< Loads checked */
+    uint64_t  tears;            /**< Loads that were torn or went backwards */
+    uint64_t  stale;            /**< Payload entries that did not hold what the writer set before the store */
+} stressReader_t;
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Shared locations under test, the payload published with them and the run settings.
+ **/
+static uint32_t stress_shared64[2] __attribute__((aligned(8)));
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+static uint64_t stress_shared128[2] __attribute__((aligned(16)));
+#endif
+static uint32_t *stress_payload;
+static uint32_t stress_stores = STRESS_STORES;
+
+/**
+ * @brief Set by the writer after its last store.
+ **/
+static uint32_t stress_done;
+
+/**
+ *  @fn      stressWriter
+ *  @package memory_bench
+ *
+ *  @brief   Stores 1 .. stress_stores, each after setting its payload entry.
+ **/
+static void *stressWriter(void *argument)
+{
+    uint32_t value[2] = { 0u, 0u };
+    uint32_t store = 0u;
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+    uint64_t wide[2] = { 0u, 0u };
+#endif
+
+    (void)argument;
+
+    for (store = 1u; store <= stress_stores; ++store)
+    {
+        stress_payload[store] = store ^ 0xA5A5A5A5u;
+
+        value[0] = store;
+        value[1] = ~store;
+        (void)MEM_atomicStore64(value, stress_shared64);
+
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+        wide[0] = ((uint64_t)store << 32) | (uint64_t)(~store);
+        wide[1] = (uint64_t)store * STRESS_SPREAD;
+        (void)MEM_atomicStore128(wide, stress_shared128);
+#endif
+    }
+
+    __atomic_store_n(&stress_done, 1u, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/**
+ *  @fn      stressReader
+ *  @package memory_bench
+ *
+ *  @brief   Loads until the writer is done, checking every value and the payload published with it.
+ **/
+static void *stressReader(void *argument)
+{
+    stressReader_t *reader = (stressReader_t *)argument;
+    uint32_t value[2] = { 0u, 0u };
+    uint32_t last = 0u;
+    int done = 0;
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+    uint64_t wide[2] = { 0u, 0u };
+    uint32_t wide_last = 0u;
+    uint32_t wide_store = 0u;
+#endif
+
+    while (done == 0)
+    {
+        /* Sampled before the loads, so the values after the writer finished are still checked. */
+        done = (__atomic_load_n(&stress_done, __ATOMIC_ACQUIRE) != 0u);
+
+        (void)MEM_atomicLoad64(stress_shared64, value);
+        ++reader->reads;
+
+        if ((value[0] != 0u) || (value[1] != 0u))
+        {
+            if ((value[1] != ~value[0]) || (value[0] < last) || (value[0] > stress_stores))
+            {
+                ++reader->tears;
+            }
+            else if (stress_payload[value[0]] != (value[0] ^ 0xA5A5A5A5u))
+            {
+                ++reader->stale;
+            }
+
+            last = value[0];
+        }
+
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+        (void)MEM_atomicLoad128(stress_shared128, wide);
+        ++reader->reads;
+
+        if ((wide[0] != 0u) || (wide[1] != 0u))
+        {
+            wide_store = (uint32_t)(wide[0] >> 32);
+
+            if (((uint32_t)wide[0] != ~wide_store) || (wide[1] != ((uint64_t)wide_store * STRESS_SPREAD))
+                || (wide_store < wide_last))
+            {
+                ++reader->tears;
+            }
+
+            wide_last = wide_store;
+        }
+#endif
+    }
+
+    return NULL;
+}
+
+/**
+ *  @fn      stressParse
+ *  @package memory_bench
+ *
+ *  @brief   Parses the command line; returns non-zero on an unknown or incomplete option.
+ **/
+static int stressParse(int argc, char **argv, unsigned *readers)
+{
+    int index = 1;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if ((strcmp(argv[index], "--readers") == 0) && (index + 1 < argc))
+        {
+            *readers = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--stores") == 0) && (index + 1 < argc))
+        {
+            stress_stores = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [--readers n] [--stores n]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if ((*readers == 0u) || (*readers > STRESS_MAX_READERS) || (stress_stores == 0u)
+        || (stress_stores == UINT32_MAX))
+    {
+        (void)fprintf(stderr, "memory_atomic_stress: --readers must be 1-%u and --stores 1-%u\n",
+                      STRESS_MAX_READERS, UINT32_MAX - 1u);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static stressReader_t readers[STRESS_MAX_READERS];
+    pthread_t writer;
+    unsigned reader_count = STRESS_READERS;
+    unsigned index = 0u;
+    uint64_t reads = 0u;
+    uint64_t tears = 0u;
+    uint64_t stale = 0u;
+    int status_out = EXIT_SUCCESS;
+
+    if (stressParse(argc, argv, &reader_count) != 0)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    stress_payload = (uint32_t *)calloc((size_t)stress_stores + 1u, sizeof(uint32_t));
+
+    if (stress_payload == NULL)
+    {
+        (void)fprintf(stderr, "memory_atomic_stress: cannot allocate the payload of %u stores\n", stress_stores);
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    for (index = 0u; index < reader_count; ++index)
+    {
+        if (pthread_create(&readers[index].thread, NULL, stressReader, &readers[index]) != 0)
+        {
+            (void)fprintf(stderr, "memory_atomic_stress: cannot start reader %u\n", index);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (pthread_create(&writer, NULL, stressWriter, NULL) != 0)
+    {
+        (void)fprintf(stderr, "memory_atomic_stress: cannot start the writer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    (void)pthread_join(writer, NULL);
+
+    for (index = 0u; index < reader_count; ++index)
+    {
+        (void)pthread_join(readers[index].thread, NULL);
+        reads += readers[index].reads;
+        tears += readers[index].tears;
+        stale += readers[index].stale;
+    }
+
+    (void)printf("%u stores of 8%s bytes, %u readers: %llu loads checked, %llu tears, %llu stale payloads\n",
+                 stress_stores, (MEM_ATOMIC_MAX_LOCK_FREE >= 16u) ? " and 16" : "", reader_count,
+                 (unsigned long long)reads, (unsigned long long)tears, (unsigned long long)stale);
+
+    if ((tears != 0u) || (stale != 0u))
+    {
+        status_out = EXIT_FAILURE;
+    }
+
+    free(stress_payload);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
@@ -0,0 +1,1433 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Host benchmark of the MEM_* kernels against memcpy, memset, memcmp, memchr and memmem.
+ *
+ *  @file       memory_bench.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Sweeps power-of-two sizes from 1 B to 64 MiB and every source/destination alignment pair
+ *              modulo 8, and times each MEM_* function against its libc counterpart on the same buffers.
+ *              Every sample repeats the call until about BENCH_TARGET_BYTES have been processed. The run is
+ *              organized in BENCH_REPEATS rounds (or --runs); each round takes one sample of every pair in
+ *              turn, so a slow phase of the machine is spread over all pairs instead of landing on one. The
+ *              table reports the best sample. Cycles come from the TSC on x86_64 and are derived from the wall
+ *              clock and --ghz elsewhere. The table is printed once every round has run.
+ *
+ *              Build and run from the repository root:
+ *
+ *                  gcc -O2 -std=gnu11 -Iinc -Isrc bench/memory_bench.c src/memory_ops.c -o memory_bench -lm
+ *                  ./memory_bench [--csv file] [--max-size bytes] [--quick] [--ghz freq] [--counters]
+ *                                 [--runs n] [--save-baseline file] [--baseline file] [--threshold fraction]
+ *                  ./memory_bench --check
+ *
+ *              The readable table (one line per function and size) goes to stdout; the CSV (one line per
+ *              function, size and alignment pair) goes to the --csv file, or is skipped without it.
+ *              --quick restricts the sweep to the aligned pair and one misaligned pair. MEM_findByte and
+ *              MEM_findPattern search for bytes absent from the buffer, so every call scans the full size; their
+ *              sweep is over the buffer alignment only, reported as the destination offset.
+ *
+ *              --check skips the timing and cross-checks MEM_findByte against a byte loop and MEM_findPattern
+ *              against memmem over every buffer offset modulo 8, size up to BENCH_CHECK_SIZE, match position
+ *              (including no match) and pattern length up to BENCH_CHECK_PATTERN. The buffers are built from
+ *              near-miss bytes so the word-at-a-time zero test and the candidate rejection are both exercised.
+ *              Any mismatch is printed and the run exits with EXIT_FAILURE.
+ *
+ *              Regression detection: --save-baseline file stores, for every function, size and alignment pair,
+ *              the raw ns/op samples of the MEM_* function and of its libc counterpart (--runs of each,
+ *              BENCH_REPEATS by default, at most BENCH_MAX_RUNS). The two are taken back to back in every
+ *              round, so their ratio cancels what the machine does to both at that moment (frequency, other
+ *              load, a slow phase of a shared host). A later run with --baseline file measures the same pairs
+ *              and flags a pair when both hold:
+ *              - a one-sided Mann-Whitney rank-sum test of its MEM_* to libc ratios against the baseline ratios
+ *                rejects "not slower" at BENCH_ALPHA (normal approximation, ties counted as one half);
+ *              - its median ratio is more than --threshold (a fraction, 0.05 by default) above the baseline
+ *                median ratio, and that excess amounts to more than BENCH_NOISE_FLOOR_NS per call.
+ *              A flagged pair is then measured again, with fresh samples interleaved over the flagged pairs
+ *              only, and is reported only when the second measurement is flagged too. Confirmed regressions
+ *              are listed on stderr and the run exits with BENCH_EXIT_REGRESSION. Samples of one pair taken back
+ *              to back would only show the noise of that moment, which is why every pass is interleaved. The
+ *              ratio makes the gate blind to a change that slows libc by the same factor, which a rebuild of
+ *              the MEM_* kernels cannot do. Typical use around an edit of the asm loops:
+ *
+ *                  ./memory_bench --quick --max-size 65536 --runs 15 --save-baseline base.csv
+ *                  ... edit, rebuild ...
+ *                  ./memory_bench --quick --max-size 65536 --runs 15 --baseline base.csv
+ *
+ *              Baselines only compare runs of the same host, build flags and MEM_CONFIG_PROFILE. Use at least
+ *              8 runs on both sides: below that the rank-sum test cannot reach BENCH_ALPHA, and the run says so.
+ *              On a shared single-core host, three runs of an unchanged binary against a 15-run baseline came
+ *              back clean, while MEM_fillStruct slowed by a few nanoseconds per call was flagged on 26 pairs.
+ *
+ *              --counters (Linux) also records cycles, instructions, L1D read misses, LLC misses and branch
+ *              misses per call of the MEM_* function through perf_event_open, during the sample that is
+ *              reported. The values are added to the CSV and summarized in the table as IPC and misses per
+ *              call. Counters the kernel or the CPU does not provide are left empty; perf_event_paranoid may
+ *              have to be lowered to 2 or below.
+ *
+ *  @see        - memory_ops.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#define _GNU_SOURCE     /* memmem */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "memory_ops.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def BENCH_MAX_SIZE
+ * @brief Largest size of the sweep (64 MiB).
+ **/
+#define BENCH_MAX_SIZE              ((size_t)64u << 20)
+
+/**
+ * @def BENCH_ALIGN_SPAN
+ * @brief Alignment offsets 0 .. BENCH_ALIGN_SPAN - 1 are swept for source and destination.
+ **/
+#define BENCH_ALIGN_SPAN            (8u)
+
+/**
+ * @def BENCH_TARGET_BYTES
+ * @brief Bytes processed per sample; small sizes repeat the call to reach it.
+ **/
+#define BENCH_TARGET_BYTES          ((size_t)16u << 20)
+
+/**
+ * @def BENCH_MAX_ITERATIONS
+ * @brief Upper bound on calls per sample, so tiny sizes do not dominate the run time.
+ **/
+#define BENCH_MAX_ITERATIONS        ((size_t)200000u)
+
+/**
+ * @def BENCH_REPEATS
+ * @brief Samples per measurement; the fastest is reported.
+ **/
+#define BENCH_REPEATS               (5u)
+
+/**
+ * @def BENCH_MAX_RUNS
+ * @brief Upper bound of --runs.
+ **/
+#define BENCH_MAX_RUNS              (64u)
+
+/**
+ * @def BENCH_THRESHOLD
+ * @brief Default --threshold: relative slowdown of the median that counts as a regression.
+ **/
+#define BENCH_THRESHOLD             (0.05)
+
+/**
+ * @def BENCH_ALPHA
+ * @brief One-sided significance level of the rank-sum test against a baseline.
+ **/
+#define BENCH_ALPHA                 (0.001)
+
+/**
+ * @def BENCH_NOISE_FLOOR_NS
+ * @brief Smallest median slowdown, in nanoseconds per call, reported as a regression.
+ **/
+#define BENCH_NOISE_FLOOR_NS        (0.5)
+
+/**
+ * @def BENCH_EXIT_REGRESSION
+ * @brief Exit status of a run that regressed against its --baseline.
+ **/
+#define BENCH_EXIT_REGRESSION       (2)
+
+/**
+ * @def BENCH_FILL_VALUE
+ * @brief Content of both buffers and value written by the fill functions, so compares always scan fully.
+ **/
+#define BENCH_FILL_VALUE            ((uint8_t)0x5Au)
+
+/**
+ * @def BENCH_FIND_VALUE
+ * @brief Byte searched for by the find rows; never present in the buffers.
+ **/
+#define BENCH_FIND_VALUE            ((uint8_t)0xA5u)
+
+/**
+ * @def BENCH_CHECK_SIZE
+ * @brief Largest buffer size of the --check sweep.
+ **/
+#define BENCH_CHECK_SIZE            (80u)
+
+/**
+ * @def BENCH_CHECK_PATTERN
+ * @brief Longest pattern of the --check sweep.
+ **/
+#define BENCH_CHECK_PATTERN         (9u)
+
+/**
+ * @def BENCH_COUNTER_COUNT
+ * @brief Number of hardware counters recorded with --counters.
+ **/
+#define BENCH_COUNTER_COUNT         (5u)
+
+/* =================================
+ *          PRIVATE TYPES          *
+ * ================================*/
+
+/**
+ * @brief Uniform signature of every benchmarked function.
+ **/
+typedef int (*benchFn_t)(void *destine, const void *source, size_t size);
+
+/**
+ * @struct benchCase
+ * @brief One MEM_* function and its libc reference.
+ **/
+typedef struct benchCase
+{
+    const char *name;           /**< Name of the MEM_* function */
+    benchFn_t   mem_fn;         /**< MEM_* wrapper */
+    benchFn_t   libc_fn;        /**< libc wrapper */
+    int         uses_source;    /**< Zero when the source alignment is irrelevant (fill) */
+} benchCase_t;
+
+/**
+ * @struct benchSample
+ * @brief Best time of one function on one size and alignment pair.
+ **/
+typedef struct benchSample
+{
+    double ns_per_op;           /**< Nanoseconds per call */
+    double cycles_per_op;       /**< Cycles per call */
+    double counters[BENCH_COUNTER_COUNT]; /**< Hardware counts per call, NAN when not recorded */
+} benchSample_t;
+
+/**
+ * @struct benchPair
+ * @brief One function, size and alignment pair of the sweep, with its samples so far.
+ **/
+typedef struct benchPair
+{
+    const benchCase_t *bench_case;     /**< Function under test */
+    size_t        size;                 /**< Size of the call */
+    unsigned      source_align;         /**< Source offset */
+    unsigned      destine_align;        /**< Destination offset */
+    benchSample_t mem_best;             /**< Best sample of the MEM_* function */
+    benchSample_t libc_best;            /**< Best sample of the libc function */
+    double        run_ns[BENCH_MAX_RUNS]; /**< ns/op of every MEM_* sample, in round order */
+    double        libc_ns[BENCH_MAX_RUNS]; /**< ns/op of every libc sample, in round order */
+    unsigned      runs;                 /**< Samples in run_ns and libc_ns */
+} benchPair_t;
+
+/**
+ * @struct benchOptions
+ * @brief Command-line settings.
+ **/
+typedef struct benchOptions
+{
+    const char *csv_path;       /**< CSV output file, or NULL */
+    size_t      max_size;       /**< Largest size of the sweep */
+    int         quick;          /**< Non-zero: aligned pair and one misaligned pair only */
+    double      ghz;            /**< Clock used to derive cycles when there is no TSC */
+    int         counters;       /**< Non-zero: record hardware counters */
+    unsigned    runs;           /**< Samples per measurement */
+    const char *save_path;      /**< Baseline file to write, or NULL */
+    const char *baseline_path;  /**< Baseline file to compare against, or NULL */
+    double      threshold;      /**< Relative slowdown of the median tolerated before a regression */
+    int         check;          /**< Non-zero: run the find cross-check instead of the benchmark */
+} benchOptions_t;
+
+/**
+ * @struct benchBaselineEntry
+ * @brief Raw samples of one function, size and alignment pair.
+ **/
+typedef struct benchBaselineEntry
+{
+    char     name[32];          /**< Name of the MEM_* function */
+    size_t   size;              /**< Size of the call */
+    unsigned source_align;      /**< Source offset */
+    unsigned destine_align;     /**< Destination offset */
+    double   run_ns[BENCH_MAX_RUNS]; /**< ns/op of every MEM_* sample */
+    double   libc_ns[BENCH_MAX_RUNS]; /**< ns/op of every libc sample */
+    unsigned runs;              /**< Samples in run_ns and libc_ns */
+} benchBaselineEntry_t;
+
+/**
+ * @struct benchBaseline
+ * @brief Entries of a loaded baseline file.
+ **/
+typedef struct benchBaseline
+{
+    benchBaselineEntry_t *entries;  /**< Growable array */
+    size_t                count;    /**< Entries in use */
+    size_t                capacity; /**< Entries allocated */
+} benchBaseline_t;
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+static int benchMemCopy(void *destine, const void *source, size_t size)
+{
+    return (int)MEM_copyStruct(source, destine, size);
+}
+
+static int benchLibcCopy(void *destine, const void *source, size_t size)
+{
+    return (memcpy(destine, source, size) == NULL);
+}
+
+static int benchMemFill(void *destine, const void *source, size_t size)
+{
+    (void)source;
+    return (int)MEM_fillStruct(destine, size, BENCH_FILL_VALUE);
+}
+
+static int benchLibcFill(void *destine, const void *source, size_t size)
+{
+    (void)source;
+    return (memset(destine, BENCH_FILL_VALUE, size) == NULL);
+}
+
+static int benchMemCompare(void *destine, const void *source, size_t size)
+{
+    return (int)MEM_compareStructs(destine, source, size);
+}
+
+static int benchLibcCompare(void *destine, const void *source, size_t size)
+{
+    return memcmp(destine, source, size);
+}
+
+/**
+ * @brief Pattern of the MEM_findPattern row; its first byte is absent from the buffers.
+ **/
+static const uint8_t bench_find_pattern[4] =
+{
+    BENCH_FIND_VALUE, BENCH_FILL_VALUE, BENCH_FILL_VALUE, BENCH_FIND_VALUE
+};
+
+static int benchMemFindByte(void *destine, const void *source, size_t size)
+{
+    (void)source;
+    return (int)MEM_findByte(destine, size, BENCH_FIND_VALUE, NULL);
+}
+
+static int benchLibcFindByte(void *destine, const void *source, size_t size)
+{
+    (void)source;
+    return (memchr(destine, BENCH_FIND_VALUE, size) != NULL);
+}
+
+static int benchMemFindPattern(void *destine, const void *source, size_t size)
+{
+    (void)source;
+    return (int)MEM_findPattern(destine, size, bench_find_pattern, sizeof(bench_find_pattern), NULL);
+}
+
+static int benchLibcFindPattern(void *destine, const void *source, size_t size)
+{
+    (void)source;
+    return (memmem(destine, size, bench_find_pattern, sizeof(bench_find_pattern)) != NULL);
+}
+
+/**
+ * @brief Benchmarked functions, in report order.
+ **/
+static const benchCase_t bench_cases[] =
+{
+    { "MEM_copyStruct",     benchMemCopy,    benchLibcCopy,    1 },
+    { "MEM_fillStruct",     benchMemFill,    benchLibcFill,    0 },
+    { "MEM_compareStructs", benchMemCompare, benchLibcCompare, 1 },
+    { "MEM_findByte",       benchMemFindByte,    benchLibcFindByte,    0 },
+    { "MEM_findPattern",    benchMemFindPattern, benchLibcFindPattern, 0 },
+};
+
+/**
+ * @brief Keeps the compiler from discarding the calls under test.
+ **/
+static volatile int bench_sink;
+
+/**
+ * @brief Column names of the hardware counters, in bench_counter_fds order.
+ **/
+static const char *const bench_counter_names[BENCH_COUNTER_COUNT] =
+{
+    "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+};
+
+/**
+ * @brief perf_event file descriptors, -1 for a counter that could not be opened.
+ **/
+static int bench_counter_fds[BENCH_COUNTER_COUNT] = { -1, -1, -1, -1, -1 };
+
+/**
+ *  @fn      benchCountersOpen
+ *  @package memory_bench
+ *
+ *  @brief   Opens the hardware counters for the calling thread; returns the number that could be opened.
+ **/
+static unsigned benchCountersOpen(void)
+{
+    unsigned opened_out = 0u;
+
+#if defined(__linux__)
+    static const uint32_t types[BENCH_COUNTER_COUNT] =
+    {
+        PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE
+    };
+    static const uint64_t configs[BENCH_COUNTER_COUNT] =
+    {
+        PERF_COUNT_HW_CPU_CYCLES,
+        PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_L1D | ((uint64_t)PERF_COUNT_HW_CACHE_OP_READ << 8)
+                                | ((uint64_t)PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES
+    };
+    unsigned index = 0u;
+
+    for (index = 0u; index < BENCH_COUNTER_COUNT; ++index)
+    {
+        struct perf_event_attr attr;
+
+        (void)memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = types[index];
+        attr.config = configs[index];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        bench_counter_fds[index] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+
+        if (bench_counter_fds[index] >= 0)
+        {
+            ++opened_out;
+        }
+    }
+#endif
+
+    return opened_out;
+}
+
+/**
+ *  @fn      benchCountersStart
+ *  @package memory_bench
+ *
+ *  @brief   Resets and enables every open counter.
+ **/
+static void benchCountersStart(void)
+{
+#if defined(__linux__)
+    unsigned index = 0u;
+
+    for (index = 0u; index < BENCH_COUNTER_COUNT; ++index)
+    {
+        if (bench_counter_fds[index] >= 0)
+        {
+            (void)ioctl(bench_counter_fds[index], PERF_EVENT_IOC_RESET, 0);
+            (void)ioctl(bench_counter_fds[index], PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+/**
+ *  @fn      benchCountersStop
+ *  @package memory_bench
+ *
+ *  @brief   Disables the counters and stores their counts divided by iterations; NAN for missing ones.
+ **/
+static void benchCountersStop(double *per_op, size_t iterations)
+{
+    unsigned index = 0u;
+
+    for (index = 0u; index < BENCH_COUNTER_COUNT; ++index)
+    {
+        per_op[index] = NAN;
+
+#if defined(__linux__)
+        if (bench_counter_fds[index] >= 0)
+        {
+            uint64_t count = 0u;
+
+            (void)ioctl(bench_counter_fds[index], PERF_EVENT_IOC_DISABLE, 0);
+
+            if (read(bench_counter_fds[index], &count, sizeof(count)) == (ssize_t)sizeof(count))
+            {
+                per_op[index] = (double)count / (double)iterations;
+            }
+        }
+#endif
+    }
+}
+
+/**
+ *  @fn      benchCountersClose
+ *  @package memory_bench
+ *
+ *  @brief   Closes every open counter.
+ **/
+static void benchCountersClose(void)
+{
+#if defined(__linux__)
+    unsigned index = 0u;
+
+    for (index = 0u; index < BENCH_COUNTER_COUNT; ++index)
+    {
+        if (bench_counter_fds[index] >= 0)
+        {
+            (void)close(bench_counter_fds[index]);
+            bench_counter_fds[index] = -1;
+        }
+    }
+#endif
+}
+
+/**
+ *  @fn      benchNowNs
+ *  @package memory_bench
+ *
+ *  @brief   Monotonic wall clock in nanoseconds.
+ **/
+static uint64_t benchNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ *  @fn      benchNowCycles
+ *  @package memory_bench
+ *
+ *  @brief   Cycle counter, or zero when the host has none readable from user space.
+ **/
+static uint64_t benchNowCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint64_t)__rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+/**
+ *  @fn      benchCompareDoubles
+ *  @package memory_bench
+ *
+ *  @brief   qsort comparator of doubles, ascending.
+ **/
+static int benchCompareDoubles(const void *left, const void *right)
+{
+    const double a = *(const double *)left;
+    const double b = *(const double *)right;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ *  @fn      benchMedian
+ *  @package memory_bench
+ *
+ *  @brief   Median of count samples; the samples are left untouched.
+ **/
+static double benchMedian(const double *values, unsigned count)
+{
+    double sorted[BENCH_MAX_RUNS];
+
+    (void)memcpy(sorted, values, count * sizeof(values[0]));
+    qsort(sorted, count, sizeof(sorted[0]), benchCompareDoubles);
+
+    return ((count % 2u) != 0u) ? sorted[count / 2u] : (0.5 * (sorted[(count / 2u) - 1u] + sorted[count / 2u]));
+}
+
+/**
+ *  @fn      benchRankSumP
+ *  @package memory_bench
+ *
+ *  @brief   One-sided p-value of the Mann-Whitney test that current is not slower than baseline.
+ *
+ *  @details U counts the (current, baseline) sample pairs where the current one is slower, ties as one half.
+ *           Without a shift U is centred on n * m / 2 with variance n * m * (n + m + 1) / 12; the p-value is
+ *           the normal tail above U, with a continuity correction. Ties only lower the true variance, so the
+ *           approximation errs on the conservative side.
+ **/
+static double benchRankSumP(const double *current, unsigned current_runs, const double *baseline,
+                            unsigned baseline_runs)
+{
+    const double pairs = (double)current_runs * (double)baseline_runs;
+    const double sigma = sqrt((pairs * (double)(current_runs + baseline_runs + 1u)) / 12.0);
+    double u = 0.0;
+    unsigned index = 0u;
+    unsigned other = 0u;
+
+    for (index = 0u; index < current_runs; ++index)
+    {
+        for (other = 0u; other < baseline_runs; ++other)
+        {
+            u += (current[index] > baseline[other]) ? 1.0 : ((current[index] == baseline[other]) ? 0.5 : 0.0);
+        }
+    }
+
+    return 0.5 * erfc(((u - 0.5) - (0.5 * pairs)) / (sigma * sqrt(2.0)));
+}
+
+/**
+ *  @fn      benchSampleOnce
+ *  @package memory_bench
+ *
+ *  @brief   Takes one sample of fn on one size and alignment pair; returns its ns/op and keeps the best in best.
+ **/
+static double benchSampleOnce(benchFn_t fn, void *destine, const void *source, size_t size, double ghz,
+                              int counters, benchSample_t *best)
+{
+    size_t iterations = BENCH_TARGET_BYTES / size;
+    uint64_t start_ns = 0u;
+    uint64_t start_cycles = 0u;
+    size_t call = 0u;
+    double ns = 0.0;
+    double cycles = 0.0;
+    double counts[BENCH_COUNTER_COUNT];
+
+    if (iterations == 0u)
+    {
+        iterations = 1u;
+    }
+    else if (iterations > BENCH_MAX_ITERATIONS)
+    {
+        iterations = BENCH_MAX_ITERATIONS;
+    }
+
+    /* Warm-up: the previous pair of the round evicted the buffers and retrained the predictors. */
+    bench_sink += fn(destine, source, size);
+
+    start_ns = benchNowNs();
+    start_cycles = benchNowCycles();
+
+    if (counters != 0)
+    {
+        benchCountersStart();
+    }
+
+    for (call = 0u; call < iterations; ++call)
+    {
+        bench_sink += fn(destine, source, size);
+    }
+
+    benchCountersStop(counts, iterations);
+
+    cycles = (double)(benchNowCycles() - start_cycles) / (double)iterations;
+    ns = (double)(benchNowNs() - start_ns) / (double)iterations;
+
+    if (cycles == 0.0)
+    {
+        cycles = ns * ghz;
+    }
+
+    if (ns < best->ns_per_op)
+    {
+        best->ns_per_op = ns;
+        best->cycles_per_op = cycles;
+
+        if (counters != 0)
+        {
+            (void)memcpy(best->counters, counts, sizeof(counts));
+        }
+    }
+
+    return ns;
+}
+
+/**
+ *  @fn      benchRounds
+ *  @package memory_bench
+ *
+ *  @brief   Takes runs rounds of samples over the listed pairs, one MEM_* and one libc sample per pair and round.
+ **/
+static void benchRounds(benchPair_t *pairs, const size_t *list, size_t count, uint8_t *destine,
+                        const uint8_t *source, const benchOptions_t *options)
+{
+    unsigned round = 0u;
+    size_t index = 0u;
+
+    for (round = 0u; round < options->runs; ++round)
+    {
+        for (index = 0u; index < count; ++index)
+        {
+            benchPair_t *pair = &pairs[list[index]];
+            uint8_t *pair_destine = destine + pair->destine_align;
+            const uint8_t *pair_source = source + pair->source_align;
+
+            pair->run_ns[pair->runs] = benchSampleOnce(pair->bench_case->mem_fn, pair_destine, pair_source,
+                                                       pair->size, options->ghz, options->counters,
+                                                       &pair->mem_best);
+            pair->libc_ns[pair->runs] = benchSampleOnce(pair->bench_case->libc_fn, pair_destine, pair_source,
+                                                        pair->size, options->ghz, 0, &pair->libc_best);
+            ++pair->runs;
+        }
+    }
+}
+
+/**
+ *  @fn      benchRatios
+ *  @package memory_bench
+ *
+ *  @brief   Stores the MEM_* to libc time ratio of every round in ratio.
+ **/
+static void benchRatios(const double *run_ns, const double *libc_ns, unsigned runs, double *ratio)
+{
+    unsigned run = 0u;
+
+    for (run = 0u; run < runs; ++run)
+    {
+        ratio[run] = run_ns[run] / libc_ns[run];
+    }
+}
+
+/**
+ *  @fn      benchRegressed
+ *  @package memory_bench
+ *
+ *  @brief   True when pair is significantly and materially slower than the baseline entry, relative to libc.
+ *
+ *  @details Stores the current and baseline median ratios and the rank-sum p-value in the last three
+ *           arguments, for the report.
+ **/
+static int benchRegressed(const benchPair_t *pair, const benchBaselineEntry_t *entry, double threshold,
+                          double *median_out, double *baseline_median_out, double *p_out)
+{
+    double ratio[BENCH_MAX_RUNS];
+    double baseline_ratio[BENCH_MAX_RUNS];
+    double excess_ns = 0.0;
+
+    benchRatios(pair->run_ns, pair->libc_ns, pair->runs, ratio);
+    benchRatios(entry->run_ns, entry->libc_ns, entry->runs, baseline_ratio);
+
+    *median_out = benchMedian(ratio, pair->runs);
+    *baseline_median_out = benchMedian(baseline_ratio, entry->runs);
+    *p_out = benchRankSumP(ratio, pair->runs, baseline_ratio, entry->runs);
+
+    /* The relative excess of the ratio, in nanoseconds of the baseline MEM_* call. */
+    excess_ns = ((*median_out / *baseline_median_out) - 1.0) * benchMedian(entry->run_ns, entry->runs);
+
+    return (*median_out > (*baseline_median_out * (1.0 + threshold))) && (excess_ns > BENCH_NOISE_FLOOR_NS)
+           && (*p_out < BENCH_ALPHA);
+}
+
+/**
+ *  @fn      benchBaselineLoad
+ *  @package memory_bench
+ *
+ *  @brief   Reads a file written by --save-baseline; returns non-zero when it cannot be read.
+ **/
+static int benchBaselineLoad(const char *path, benchBaseline_t *baseline)
+{
+    char line[128u + (2u * BENCH_MAX_RUNS * 24u)];
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        (void)fprintf(stderr, "memory_bench: cannot open %s\n", path);
+        return 1;
+    }
+
+    while (fgets(line, (int)sizeof(line), file) != NULL)
+    {
+        benchBaselineEntry_t entry;
+        char *cursor = line;
+        int consumed = 0;
+
+        unsigned run = 0u;
+
+        if ((sscanf(line, "%31[^,],%zu,%u,%u,%u%n", entry.name, &entry.size, &entry.source_align,
+                    &entry.destine_align, &entry.runs, &consumed) != 5)
+            || (entry.runs == 0u) || (entry.runs > BENCH_MAX_RUNS))
+        {
+            continue;   /* Header line. */
+        }
+
+        cursor += consumed;
+
+        /* runs MEM_* samples, then runs libc samples. */
+        for (run = 0u; run < (2u * entry.runs); ++run)
+        {
+            char *end = NULL;
+            const double value = (*cursor == ',') ? strtod(cursor + 1, &end) : 0.0;
+
+            if ((end == NULL) || (end == (cursor + 1)))
+            {
+                break;
+            }
+
+            if (run < entry.runs)
+            {
+                entry.run_ns[run] = value;
+            }
+            else
+            {
+                entry.libc_ns[run - entry.runs] = value;
+            }
+
+            cursor = end;
+        }
+
+        if (run != (2u * entry.runs))
+        {
+            continue;
+        }
+
+        if (baseline->count == baseline->capacity)
+        {
+            const size_t capacity = (baseline->capacity == 0u) ? 256u : (baseline->capacity * 2u);
+            benchBaselineEntry_t *entries =
+                (benchBaselineEntry_t *)realloc(baseline->entries, capacity * sizeof(*entries));
+
+            if (entries == NULL)
+            {
+                (void)fclose(file);
+                return 1;
+            }
+
+            baseline->entries = entries;
+            baseline->capacity = capacity;
+        }
+
+        baseline->entries[baseline->count++] = entry;
+    }
+
+    (void)fclose(file);
+
+    return 0;
+}
+
+/**
+ *  @fn      benchBaselineFind
+ *  @package memory_bench
+ *
+ *  @brief   Returns the baseline entry of one function, size and alignment pair, or NULL.
+ **/
+static const benchBaselineEntry_t *benchBaselineFind(const benchBaseline_t *baseline, const char *name,
+                                                     size_t size, unsigned source_align, unsigned destine_align)
+{
+    size_t index = 0u;
+
+    for (index = 0u; index < baseline->count; ++index)
+    {
+        const benchBaselineEntry_t *entry = &baseline->entries[index];
+
+        if ((entry->size == size) && (entry->source_align == source_align)
+            && (entry->destine_align == destine_align) && (strcmp(entry->name, name) == 0))
+        {
+            return entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ *  @fn      benchParse
+ *  @package memory_bench
+ *
+ *  @brief   Parses the command line; returns non-zero on an unknown or incomplete option.
+ **/
+static int benchParse(int argc, char **argv, benchOptions_t *options)
+{
+    int index = 1;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if ((strcmp(argv[index], "--csv") == 0) && (index + 1 < argc))
+        {
+            options->csv_path = argv[++index];
+        }
+        else if ((strcmp(argv[index], "--max-size") == 0) && (index + 1 < argc))
+        {
+            options->max_size = (size_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--ghz") == 0) && (index + 1 < argc))
+        {
+            options->ghz = strtod(argv[++index], NULL);
+        }
+        else if (strcmp(argv[index], "--quick") == 0)
+        {
+            options->quick = 1;
+        }
+        else if (strcmp(argv[index], "--counters") == 0)
+        {
+            options->counters = 1;
+        }
+        else if ((strcmp(argv[index], "--runs") == 0) && (index + 1 < argc))
+        {
+            options->runs = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--save-baseline") == 0) && (index + 1 < argc))
+        {
+            options->save_path = argv[++index];
+        }
+        else if ((strcmp(argv[index], "--baseline") == 0) && (index + 1 < argc))
+        {
+            options->baseline_path = argv[++index];
+        }
+        else if ((strcmp(argv[index], "--threshold") == 0) && (index + 1 < argc))
+        {
+            options->threshold = strtod(argv[++index], NULL);
+        }
+        else if (strcmp(argv[index], "--check") == 0)
+        {
+            options->check = 1;
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [--csv file] [--max-size bytes] [--quick] [--ghz freq] [--counters]\n"
+                                  "       [--runs n] [--save-baseline file] [--baseline file] [--threshold fraction]\n"
+                                  "       %s --check\n",
+                          argv[0], argv[0]);
+            return 1;
+        }
+    }
+
+    if ((options->max_size == 0u) || (options->max_size > BENCH_MAX_SIZE))
+    {
+        options->max_size = BENCH_MAX_SIZE;
+    }
+
+    if ((options->runs == 0u) || (options->runs > BENCH_MAX_RUNS))
+    {
+        options->runs = (options->runs == 0u) ? BENCH_REPEATS : BENCH_MAX_RUNS;
+    }
+
+    return 0;
+}
+
+/**
+ *  @fn      benchAlignSkipped
+ *  @package memory_bench
+ *
+ *  @brief   True for the alignment pairs left out of the sweep.
+ **/
+static int benchAlignSkipped(const benchOptions_t *options, const benchCase_t *bench_case,
+                             unsigned source_align, unsigned destine_align)
+{
+    if ((bench_case->uses_source == 0) && (source_align != 0u))
+    {
+        return 1;
+    }
+
+    if (options->quick != 0)
+    {
+        return !((source_align == destine_align) && (destine_align == 0u))
+               && !((source_align == (bench_case->uses_source ? 1u : 0u)) && (destine_align == 3u));
+    }
+
+    return 0;
+}
+
+/**
+ *  @fn      benchCheckFind
+ *  @package memory_bench
+ *
+ *  @brief   Cross-checks MEM_findByte and MEM_findPattern against references; returns the number of mismatches.
+ *
+ *  @details For every offset, size and match position the buffer is refilled with near-miss bytes of the
+ *           target (target ^ 0x80, target ^ 0x01, 0x00, 0xFF, target - 1), the target is planted at the
+ *           position and again near the end, and MEM_findByte must report the first one. For MEM_findPattern
+ *           the buffer and the patterns use a two-letter alphabet, so partial matches abound, one pattern copy
+ *           is planted at the position and the result must equal memmem's.
+ **/
+static size_t benchCheckFind(void)
+{
+    static const uint8_t near_miss[5] =
+    {
+        BENCH_FIND_VALUE ^ 0x80u, BENCH_FIND_VALUE ^ 0x01u, 0x00u, 0xFFu, BENCH_FIND_VALUE - 1u
+    };
+    uint8_t storage[BENCH_ALIGN_SPAN + BENCH_CHECK_SIZE];
+    uint8_t pattern[BENCH_CHECK_PATTERN];
+    size_t cases = 0u;
+    size_t mismatches = 0u;
+    unsigned align = 0u;
+    size_t size = 0u;
+    size_t position = 0u;
+    size_t length = 0u;
+    size_t index = 0u;
+
+    for (align = 0u; align < BENCH_ALIGN_SPAN; ++align)
+    {
+        uint8_t *buffer = storage + align;
+
+        for (size = 0u; size <= BENCH_CHECK_SIZE; ++size)
+        {
+            /* position == size plants nothing: the not-found case. */
+            for (position = 0u; position <= size; ++position)
+            {
+                size_t expected = size;
+                size_t found = 0u;
+                MEM_struct_search_t status = PATTERN_NOT_FOUND;
+
+                for (index = 0u; index < size; ++index)
+                {
+                    buffer[index] = near_miss[(index + position) % sizeof(near_miss)];
+                }
+
+                if (position < size)
+                {
+                    buffer[position] = BENCH_FIND_VALUE;
+                    buffer[size - 1u] = BENCH_FIND_VALUE;
+                }
+
+                for (index = 0u; index < size; ++index)
+                {
+                    if (buffer[index] == BENCH_FIND_VALUE)
+                    {
+                        expected = index;
+                        break;
+                    }
+                }
+
+                status = MEM_findByte(buffer, size, BENCH_FIND_VALUE, &found);
+                ++cases;
+
+                if ((status != ((expected < size) ? PATTERN_FOUND : PATTERN_NOT_FOUND))
+                    || ((expected < size) && (found != expected)))
+                {
+                    ++mismatches;
+                    (void)fprintf(stderr, "MEM_findByte align %u size %zu position %zu: status %d offset %zu, "
+                                          "expected %zu\n", align, size, position, (int)status, found, expected);
+                }
+
+                for (length = 1u; length <= BENCH_CHECK_PATTERN; ++length)
+                {
+                    const uint8_t *reference = NULL;
+
+                    for (index = 0u; index < length; ++index)
+                    {
+                        pattern[index] = (((index * 5u) + length) % 3u == 0u) ? (uint8_t)'b' : (uint8_t)'a';
+                    }
+
+                    for (index = 0u; index < size; ++index)
+                    {
+                        buffer[index] = (((index * 7u) + position) % 4u == 0u) ? (uint8_t)'b' : (uint8_t)'a';
+                    }
+
+                    if ((position < size) && (length <= size - position))
+                    {
+                        (void)memcpy(buffer + position, pattern, length);
+                    }
+
+                    reference = (const uint8_t *)memmem(buffer, size, pattern, length);
+                    status = MEM_findPattern(buffer, size, pattern, length, &found);
+                    ++cases;
+
+                    if ((status != ((reference != NULL) ? PATTERN_FOUND : PATTERN_NOT_FOUND))
+                        || ((reference != NULL) && (found != (size_t)(reference - buffer))))
+                    {
+                        ++mismatches;
+                        (void)fprintf(stderr, "MEM_findPattern align %u size %zu position %zu length %zu: "
+                                              "status %d offset %zu, memmem %ld\n", align, size, position, length,
+                                      (int)status, found, (reference != NULL) ? (long)(reference - buffer) : -1L);
+                    }
+                }
+            }
+        }
+    }
+
+    (void)printf("check: %zu cases, %zu mismatches\n", cases, mismatches);
+
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    benchOptions_t options = { NULL, BENCH_MAX_SIZE, 0, 1.0, 0, BENCH_REPEATS, NULL, NULL, BENCH_THRESHOLD, 0 };
+    benchBaseline_t baseline = { NULL, 0u, 0u };
+    FILE *csv = NULL;
+    FILE *save = NULL;
+    benchPair_t *pairs = NULL;
+    size_t *list = NULL;
+    size_t pair_count = 0u;
+    size_t flagged = 0u;
+    size_t compared = 0u;
+    size_t regressions = 0u;
+    uint8_t *source = NULL;
+    uint8_t *destine = NULL;
+    size_t case_index = 0u;
+    size_t index = 0u;
+    size_t first = 0u;
+    size_t last = 0u;
+    size_t size = 0u;
+    unsigned source_align = 0u;
+    unsigned destine_align = 0u;
+    unsigned counter = 0u;
+    int status_out = EXIT_SUCCESS;
+
+    if (benchParse(argc, argv, &options) != 0)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    if (options.check != 0)
+    {
+        status_out = (benchCheckFind() == 0u) ? EXIT_SUCCESS : EXIT_FAILURE;
+        goto return_status;
+    }
+
+    source = (uint8_t *)aligned_alloc(64u, options.max_size + 64u);
+    destine = (uint8_t *)aligned_alloc(64u, options.max_size + 64u);
+
+    /* Upper bound of the pair count: every case, size and alignment pair. */
+    for (size = 1u; size <= options.max_size; size <<= 1)
+    {
+        pair_count += (sizeof(bench_cases) / sizeof(bench_cases[0])) * BENCH_ALIGN_SPAN * BENCH_ALIGN_SPAN;
+    }
+
+    pairs = (benchPair_t *)calloc(pair_count, sizeof(*pairs));
+    list = (size_t *)calloc(pair_count, sizeof(*list));
+
+    if ((source == NULL) || (destine == NULL) || (pairs == NULL) || (list == NULL))
+    {
+        (void)fprintf(stderr, "memory_bench: cannot allocate 2 x %zu bytes and %zu pairs\n", options.max_size + 64u,
+                      pair_count);
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    (void)memset(source, BENCH_FILL_VALUE, options.max_size + 64u);
+    (void)memset(destine, BENCH_FILL_VALUE, options.max_size + 64u);
+
+    if ((options.counters != 0) && (benchCountersOpen() == 0u))
+    {
+        (void)fprintf(stderr, "memory_bench: no hardware counter available, continuing without --counters\n");
+        options.counters = 0;
+    }
+
+    if (options.csv_path != NULL)
+    {
+        csv = fopen(options.csv_path, "w");
+
+        if (csv == NULL)
+        {
+            (void)fprintf(stderr, "memory_bench: cannot open %s\n", options.csv_path);
+            status_out = EXIT_FAILURE;
+            goto release;
+        }
+
+        (void)fprintf(csv, "function,size,src_align,dst_align,ns_per_op,bytes_per_cycle,libc_ns_per_op,"
+                           "libc_bytes_per_cycle,speedup");
+
+        for (counter = 0u; (options.counters != 0) && (counter < BENCH_COUNTER_COUNT); ++counter)
+        {
+            (void)fprintf(csv, ",%s", bench_counter_names[counter]);
+        }
+
+        (void)fprintf(csv, "\n");
+    }
+
+    if ((options.baseline_path != NULL) && (benchBaselineLoad(options.baseline_path, &baseline) != 0))
+    {
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    if (baseline.count != 0u)
+    {
+        double slower[BENCH_MAX_RUNS];
+        double faster[BENCH_MAX_RUNS];
+
+        /* Smallest p-value the run counts allow: every current sample slower than every baseline sample. */
+        for (counter = 0u; counter < BENCH_MAX_RUNS; ++counter)
+        {
+            slower[counter] = 1.0;
+            faster[counter] = 0.0;
+        }
+
+        if (benchRankSumP(slower, options.runs, faster, baseline.entries[0].runs) >= BENCH_ALPHA)
+        {
+            (void)fprintf(stderr, "memory_bench: %u runs against %u baseline runs cannot reach p < %g, no pair can "
+                                  "be flagged; use 8 or more\n", options.runs, baseline.entries[0].runs,
+                          BENCH_ALPHA);
+        }
+    }
+
+    if (options.save_path != NULL)
+    {
+        save = fopen(options.save_path, "w");
+
+        if (save == NULL)
+        {
+            (void)fprintf(stderr, "memory_bench: cannot open %s\n", options.save_path);
+            status_out = EXIT_FAILURE;
+            goto release;
+        }
+
+        (void)fprintf(save, "function,size,src_align,dst_align,runs,ns_per_op x runs,libc_ns_per_op x runs\n");
+    }
+
+    /* The pairs in report order: function, size, source offset, destination offset. */
+    pair_count = 0u;
+
+    for (case_index = 0u; case_index < (sizeof(bench_cases) / sizeof(bench_cases[0])); ++case_index)
+    {
+        for (size = 1u; size <= options.max_size; size <<= 1)
+        {
+            for (source_align = 0u; source_align < BENCH_ALIGN_SPAN; ++source_align)
+            {
+                for (destine_align = 0u; destine_align < BENCH_ALIGN_SPAN; ++destine_align)
+                {
+                    benchPair_t *pair = &pairs[pair_count];
+
+                    if (benchAlignSkipped(&options, &bench_cases[case_index], source_align, destine_align) != 0)
+                    {
+                        continue;
+                    }
+
+                    pair->bench_case = &bench_cases[case_index];
+                    pair->size = size;
+                    pair->source_align = source_align;
+                    pair->destine_align = destine_align;
+                    pair->mem_best.ns_per_op = INFINITY;
+                    pair->libc_best.ns_per_op = INFINITY;
+
+                    for (counter = 0u; counter < BENCH_COUNTER_COUNT; ++counter)
+                    {
+                        pair->mem_best.counters[counter] = NAN;
+                        pair->libc_best.counters[counter] = NAN;
+                    }
+
+                    list[pair_count] = pair_count;
+                    ++pair_count;
+                }
+            }
+        }
+    }
+
+    benchRounds(pairs, list, pair_count, destine, source, &options);
+
+    if (save != NULL)
+    {
+        for (index = 0u; index < pair_count; ++index)
+        {
+            const benchPair_t *pair = &pairs[index];
+            unsigned run = 0u;
+
+            (void)fprintf(save, "%s,%zu,%u,%u,%u", pair->bench_case->name, pair->size, pair->source_align,
+                          pair->destine_align, pair->runs);
+
+            for (run = 0u; run < pair->runs; ++run)
+            {
+                (void)fprintf(save, ",%.4f", pair->run_ns[run]);
+            }
+
+            for (run = 0u; run < pair->runs; ++run)
+            {
+                (void)fprintf(save, ",%.4f", pair->libc_ns[run]);
+            }
+
+            (void)fprintf(save, "\n");
+        }
+    }
+
+    if (baseline.count != 0u)
+    {
+        /* First pass: flag on the interleaved samples of the whole sweep. */
+        for (index = 0u; index < pair_count; ++index)
+        {
+            const benchPair_t *pair = &pairs[index];
+            const benchBaselineEntry_t *entry = benchBaselineFind(&baseline, pair->bench_case->name, pair->size,
+                                                                  pair->source_align, pair->destine_align);
+
+            double median = 0.0;
+            double baseline_median = 0.0;
+            double p = 1.0;
+
+            if (entry != NULL)
+            {
+                ++compared;
+
+                if (benchRegressed(pair, entry, options.threshold, &median, &baseline_median, &p) != 0)
+                {
+                    list[flagged++] = index;
+                }
+            }
+        }
+
+        /* Second pass: fresh samples of the flagged pairs only; a regression must show up in both. */
+        for (index = 0u; index < flagged; ++index)
+        {
+            pairs[list[index]].runs = 0u;
+        }
+
+        benchRounds(pairs, list, flagged, destine, source, &options);
+
+        for (index = 0u; index < flagged; ++index)
+        {
+            const benchPair_t *pair = &pairs[list[index]];
+            const benchBaselineEntry_t *entry = benchBaselineFind(&baseline, pair->bench_case->name, pair->size,
+                                                                  pair->source_align, pair->destine_align);
+            double median = 0.0;
+            double baseline_median = 0.0;
+            double p = 1.0;
+
+            if (benchRegressed(pair, entry, options.threshold, &median, &baseline_median, &p) != 0)
+            {
+                ++regressions;
+                (void)fprintf(stderr, "REGRESSION %s size %zu align (%u,%u): median %.2f ns, %.3f x libc vs "
+                                      "baseline %.3f x libc (+%.1f%%), rank-sum p %.2g\n",
+                              pair->bench_case->name, pair->size, pair->source_align, pair->destine_align,
+                              benchMedian(pair->run_ns, pair->runs), median, baseline_median,
+                              100.0 * ((median / baseline_median) - 1.0), p);
+            }
+        }
+    }
+
+    (void)printf("%-20s %10s %12s %12s %10s %12s %9s %9s", "function", "size", "ns/op(0,0)", "ns/op(worst)",
+                 "B/cycle", "libc ns/op", "speedup", "worst");
+
+    if (options.counters != 0)
+    {
+        (void)printf(" %6s %10s %10s %10s", "IPC", "L1D miss", "LLC miss", "br miss");
+    }
+
+    (void)printf("\n");
+
+    /* One table line per function and size: the pairs first .. last share both. */
+    for (first = 0u; first < pair_count; first = last + 1u)
+    {
+        const benchPair_t *pair = &pairs[first];
+        const benchPair_t *aligned = pair;
+        double worst_ns = 0.0;
+        double worst_speedup = INFINITY;
+
+        last = first;
+
+        while (((last + 1u) < pair_count) && (pairs[last + 1u].bench_case == pair->bench_case)
+               && (pairs[last + 1u].size == pair->size))
+        {
+            ++last;
+        }
+
+        for (index = first; index <= last; ++index)
+        {
+            const benchPair_t *current = &pairs[index];
+            const double speedup = current->libc_best.ns_per_op / current->mem_best.ns_per_op;
+
+            if ((current->source_align == 0u) && (current->destine_align == 0u))
+            {
+                aligned = current;
+            }
+
+            if (current->mem_best.ns_per_op > worst_ns)
+            {
+                worst_ns = current->mem_best.ns_per_op;
+            }
+
+            if (speedup < worst_speedup)
+            {
+                worst_speedup = speedup;
+            }
+
+            if (csv != NULL)
+            {
+                (void)fprintf(csv, "%s,%zu,%u,%u,%.3f,%.4f,%.3f,%.4f,%.3f", current->bench_case->name,
+                              current->size, current->source_align, current->destine_align,
+                              current->mem_best.ns_per_op, (double)current->size / current->mem_best.cycles_per_op,
+                              current->libc_best.ns_per_op, (double)current->size / current->libc_best.cycles_per_op,
+                              speedup);
+
+                for (counter = 0u; (options.counters != 0) && (counter < BENCH_COUNTER_COUNT); ++counter)
+                {
+                    if (isnan(current->mem_best.counters[counter]))
+                    {
+                        (void)fprintf(csv, ",");
+                    }
+                    else
+                    {
+                        (void)fprintf(csv, ",%.3f", current->mem_best.counters[counter]);
+                    }
+                }
+
+                (void)fprintf(csv, "\n");
+            }
+        }
+
+        (void)printf("%-20s %10zu %12.2f %12.2f %10.3f %12.2f %8.2fx %8.2fx", pair->bench_case->name, pair->size,
+                     aligned->mem_best.ns_per_op, worst_ns, (double)pair->size / aligned->mem_best.cycles_per_op,
+                     aligned->libc_best.ns_per_op, aligned->libc_best.ns_per_op / aligned->mem_best.ns_per_op,
+                     worst_speedup);
+
+        if (options.counters != 0)
+        {
+            /* NAN (counter missing) prints as nan, which is explicit enough for a readable table. */
+            (void)printf(" %6.2f %10.2f %10.2f %10.2f",
+                         aligned->mem_best.counters[1] / aligned->mem_best.counters[0],
+                         aligned->mem_best.counters[2], aligned->mem_best.counters[3], aligned->mem_best.counters[4]);
+        }
+
+        (void)printf("\n");
+    }
+
+    if (options.baseline_path != NULL)
+    {
+        (void)fprintf(stderr, "memory_bench: %zu of %zu baseline pairs compared, %zu flagged and re-measured, "
+                              "%zu regressed beyond %.1f%%\n",
+                      compared, baseline.count, flagged, regressions, 100.0 * options.threshold);
+
+        if (regressions != 0u)
+        {
+            status_out = BENCH_EXIT_REGRESSION;
+        }
+    }
+
+release:
+    benchCountersClose();
+
+    if (csv != NULL)
+    {
+        (void)fclose(csv);
+    }
+
+    if (save != NULL)
+    {
+        (void)fclose(save);
+    }
+
+    free(baseline.entries);
+    free(pairs);
+    free(list);
+    free(source);
+    free(destine);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
@@ -0,0 +1,690 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Bare-metal Cortex-M4 driver for instruction-count benchmarks of the MEM_* kernels under qemu.
+ *
+ *  @file       memory_bench_m4.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Runs one kernel once on one size, then exits through semihosting. The kernel and the size come
+ *              from the semihosting command line ("copy 1024", "fill 16", "compare 4096"); an optional third
+ *              number 0-3 ("copy 1024 1") offsets both buffers by that many bytes, so the call is co-aligned
+ *              and runs the byte head of the word kernels. An optional fourth number 1-size ("compare 1024 0
+ *              1021") sets that byte of the destination to 0xFF before the call, so a compare stops on it.
+ *              "find" and "filled" run MEM_findByte and MEM_isFilled over the whole (zeroed) buffer; they have
+ *              no cycle bound. A "call" or "none" prefix
+ *              ("call copy 1024", "none copy 1024") makes the run measurable: both parse the same command the
+ *              same way, and "none" stops right before the call, so subtracting its counts from the "call"
+ *              run leaves the cost of the call alone. Prefixed with "bound" ("bound copy 1024") the run
+ *              prints the MEM_cycleBound of that call as "bound: N" instead of running it. The "check" run
+ *              cross-checks the search, fill-check, compare, copy and fill kernels of the image (the M4 DSP
+ *              variants with -mcpu=cortex-m4) against plain byte loops and fails on any disagreement. qemu's
+ *              TCG plugins count the executed instructions and memory accesses of the whole run, and that
+ *              count is deterministic.
+ *
+ *              Target: qemu-system-arm -M mps2-an386 (Cortex-M4, code RAM at 0x0, data RAM at 0x20000000).
+ *              bench/memory_bench_m4.sh builds this file with every MEM_CONFIG_PROFILE, runs the sweep and
+ *              writes the CSV.
+ *
+ *              On hardware, build with -DBENCH_M4_CYCLES to also time the kernel call with MEM_CYCLE_COUNTER
+ *              (DWT->CYCCNT unless overridden) and print "cycles: N" and "bound: N" through semihosting next to
+ *              the counts gathered by the debugger; the measured cycles must stay below the bound. qemu does not
+ *              model the DWT, so the qemu sweep leaves it off.
+ *
+ *  @see        - memory_bench_m4.sh
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory_ops.h"
+#include "memory_wcet.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def BENCH_M4_MAX_SIZE
+ * @brief Largest size accepted on the command line.
+ **/
+#define BENCH_M4_MAX_SIZE           ((size_t)65536u)
+
+/**
+ * @def BENCH_M4_STACK_TOP
+ * @brief Initial stack pointer: top of the first 2 MiB of data RAM on mps2-an386.
+ **/
+#define BENCH_M4_STACK_TOP          (0x20200000u)
+
+/**
+ * @def BENCH_M4_SYS_GET_CMDLINE
+ * @brief Semihosting operation returning the command line.
+ **/
+#define BENCH_M4_SYS_GET_CMDLINE    (0x15u)
+
+/**
+ * @def BENCH_M4_SYS_WRITE0
+ * @brief Semihosting operation printing a NUL-terminated string.
+ **/
+#define BENCH_M4_SYS_WRITE0         (0x04u)
+
+/**
+ * @def BENCH_M4_DEMCR
+ * @brief Debug Exception and Monitor Control Register; bit 24 (TRCENA) powers the DWT.
+ **/
+#define BENCH_M4_DEMCR              (*(volatile uint32_t *)0xE000EDFCu)
+
+/**
+ * @def BENCH_M4_DWT_CTRL
+ * @brief DWT control register; bit 0 (CYCCNTENA) starts the cycle counter.
+ **/
+#define BENCH_M4_DWT_CTRL           (*(volatile uint32_t *)0xE0001000u)
+
+/**
+ * @def BENCH_M4_SYS_EXIT
+ * @brief Semihosting operation terminating the simulation.
+ **/
+#define BENCH_M4_SYS_EXIT           (0x18u)
+
+/**
+ * @def BENCH_M4_EXIT_OK
+ * @brief ADP_Stopped_ApplicationExit: qemu exits with status 0.
+ **/
+#define BENCH_M4_EXIT_OK            (0x20026u)
+
+/**
+ * @def BENCH_M4_EXIT_ERROR
+ * @brief ADP_Stopped_RunTimeErrorUnknown: qemu exits with status 1.
+ **/
+#define BENCH_M4_EXIT_ERROR         (0x20023u)
+
+/**
+ * @def BENCH_M4_CHECK_SIZE
+ * @brief Largest size swept by the "check" command.
+ **/
+#define BENCH_M4_CHECK_SIZE         ((size_t)48u)
+
+/**
+ * @def BENCH_M4_CHECK_BURSTS
+ * @brief Largest size of the copy/fill part of the "check" command: three 32-byte bursts and a tail.
+ **/
+#define BENCH_M4_CHECK_BURSTS       ((size_t)100u)
+
+/**
+ * @def BENCH_M4_SCAN_FIND
+ * @brief "find" command: MEM_findByte over the whole size, which holds no match.
+ **/
+#define BENCH_M4_SCAN_FIND          (1)
+
+/**
+ * @def BENCH_M4_SCAN_FILLED
+ * @brief "filled" command: MEM_isFilled over the whole size, which is filled.
+ **/
+#define BENCH_M4_SCAN_FILLED        (2)
+
+/**
+ * @def BENCH_M4_GUARD
+ * @brief Bytes checked on each side of a copy/fill destination; they must keep BENCH_M4_GUARD_BYTE.
+ **/
+#define BENCH_M4_GUARD              ((size_t)8u)
+
+/**
+ * @def BENCH_M4_GUARD_BYTE
+ * @brief Value of the guard bytes around a copy/fill destination.
+ **/
+#define BENCH_M4_GUARD_BYTE         (0xE7u)
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+extern uint32_t __bss_start__[];
+extern uint32_t __bss_end__[];
+
+void benchM4Reset(void);
+void benchM4Fault(void);
+
+/**
+ * @brief Source and destination buffers, with room for alignment offsets.
+ **/
+static uint8_t bench_source[BENCH_M4_MAX_SIZE + 8u] __attribute__((aligned(8)));
+static uint8_t bench_destine[BENCH_M4_MAX_SIZE + 8u] __attribute__((aligned(8)));
+
+/**
+ * @brief Vector table; linked at address 0 with --section-start=.vectors=0.
+ **/
+__attribute__((section(".vectors"), used))
+static const uintptr_t bench_vectors[] =
+{
+    (uintptr_t)BENCH_M4_STACK_TOP,
+    (uintptr_t)benchM4Reset,
+    (uintptr_t)benchM4Fault,        /* NMI */
+    (uintptr_t)benchM4Fault,        /* HardFault */
+    (uintptr_t)benchM4Fault,        /* MemManage */
+    (uintptr_t)benchM4Fault,        /* BusFault */
+    (uintptr_t)benchM4Fault,        /* UsageFault */
+};
+
+/**
+ *  @fn      benchM4Semihost
+ *  @package memory_bench
+ *
+ *  @brief   Issues a semihosting call - ASSEMBLY: ARM (BKPT 0xAB).
+ **/
+static uint32_t benchM4Semihost(uint32_t operation, const void *argument)
+{
+    register uint32_t r0 asm("r0") = operation;
+    register const void *r1 asm("r1") = argument;
+
+    asm volatile
+    (
+        "bkpt 0xAB                          \n\t"
+        : "+r" (r0)
+        : "r" (r1)
+        : "memory"
+    );
+
+    return r0;
+}
+
+/**
+ *  @fn      benchM4Exit
+ *  @package memory_bench
+ *
+ *  @brief   Terminates the simulation with the given semihosting stop reason.
+ **/
+static void benchM4Exit(uint32_t reason)
+{
+    for (;;)
+    {
+        (void)benchM4Semihost(BENCH_M4_SYS_EXIT, (const void *)(uintptr_t)reason);
+    }
+}
+
+void benchM4Fault(void)
+{
+    benchM4Exit(BENCH_M4_EXIT_ERROR);
+}
+
+/**
+ *  @fn      benchM4PrintValue
+ *  @package memory_bench
+ *
+ *  @brief   Prints "label: N" through semihosting; label is at most 8 characters.
+ **/
+static void benchM4PrintValue(const char *label, uint32_t value)
+{
+    char line[24];
+    char digits[11];
+    size_t count = 0u;
+    size_t length = 0u;
+
+    while ((*label != '\0') && (length < 8u))
+    {
+        line[length++] = *label++;
+    }
+
+    line[length++] = ':';
+    line[length++] = ' ';
+
+    do
+    {
+        digits[count++] = (char)('0' + (value % 10u));
+        value /= 10u;
+    } while (value != 0u);
+
+    while (count != 0u)
+    {
+        line[length++] = digits[--count];
+    }
+
+    line[length++] = '\n';
+    line[length] = '\0';
+
+    (void)benchM4Semihost(BENCH_M4_SYS_WRITE0, line);
+}
+
+/**
+ *  @fn      benchM4Matches
+ *  @package memory_bench
+ *
+ *  @brief   True when the word starting at text equals name.
+ **/
+static int benchM4Matches(const char *text, const char *name)
+{
+    while ((*name != '\0') && (*text == *name))
+    {
+        ++text;
+        ++name;
+    }
+
+    return (*name == '\0') && ((*text == ' ') || (*text == '\0'));
+}
+
+/**
+ *  @fn      benchM4Prefix
+ *  @package memory_bench
+ *
+ *  @brief   True when text starts with prefix. Reads every character of prefix whatever the result, so the
+ *           "call" and "none" runs execute the same instructions.
+ **/
+static int benchM4Prefix(const char *text, const char *prefix)
+{
+    uint32_t differ = 0u;
+
+    while (*prefix != '\0')
+    {
+        differ |= (uint32_t)(uint8_t)(*text ^ *prefix);
+        text += (*text != '\0');
+        ++prefix;
+    }
+
+    return (differ == 0u);
+}
+
+/**
+ *  @fn      benchM4CheckWrites
+ *  @package memory_bench
+ *
+ *  @brief   Cross-checks MEM_copyStruct, MEM_fillStruct and their unchecked and verified variants against
+ *           plain byte loops.
+ *
+ *  @details Sweeps every source and destination offset 0-3 (aligned, co-aligned and misaligned pairs) and
+ *           every size up to BENCH_M4_CHECK_BURSTS. The destination must hold the expected bytes and the
+ *           BENCH_M4_GUARD bytes on each side of it must be untouched. Returns the number of disagreements.
+ **/
+static uint32_t benchM4CheckWrites(void)
+{
+    uint32_t failures = 0u;
+    size_t source_start = 0u;
+    size_t destine_start = 0u;
+    size_t size = 0u;
+    size_t index = 0u;
+    size_t variant = 0u;
+
+    for (source_start = 0u; source_start < 4u; ++source_start)
+    {
+        for (destine_start = 0u; destine_start < 4u; ++destine_start)
+        {
+            for (size = 0u; size <= BENCH_M4_CHECK_BURSTS; ++size)
+            {
+                /* Copies: 0 checked, 1 unchecked, 4 verified. Fills: 2 checked, 3 unchecked, 5 verified. */
+                for (variant = 0u; variant < 6u; ++variant)
+                {
+                    const uint8_t *source = &bench_source[BENCH_M4_GUARD + source_start];
+                    uint8_t *destine = &bench_destine[BENCH_M4_GUARD + destine_start];
+                    uint8_t *guard = &bench_destine[destine_start];
+                    uint8_t expected = 0u;
+                    size_t first_bad = 0u;
+                    int status = 0;
+
+                    for (index = 0u; index < size; ++index)
+                    {
+                        bench_source[BENCH_M4_GUARD + source_start + index] = (uint8_t)((index * 13u) + size + 1u);
+                    }
+
+                    for (index = 0u; index < size + (2u * BENCH_M4_GUARD); ++index)
+                    {
+                        guard[index] = BENCH_M4_GUARD_BYTE;
+                    }
+
+                    if (variant == 0u)
+                    {
+                        status = (MEM_copyStruct(source, destine, size) != STRUCT_COPIED);
+                    }
+                    else if (variant == 1u)
+                    {
+                        status = (MEM_copyStructUnchecked(source, destine, size) != STRUCT_COPIED);
+                    }
+                    else if (variant == 2u)
+                    {
+                        status = (MEM_fillStruct(destine, size, 0x5Au) != STRUCT_FILLED);
+                    }
+                    else if (variant == 3u)
+                    {
+                        status = (MEM_fillStructUnchecked(destine, size, 0x5Au) != STRUCT_FILLED);
+                    }
+                    else if (variant == 4u)
+                    {
+                        status = (MEM_copyVerified(source, destine, size, &first_bad) != STRUCT_COPIED)
+                                 || (first_bad != size);
+                    }
+                    else
+                    {
+                        status = (MEM_fillVerified(destine, size, 0x5Au, &first_bad) != STRUCT_FILLED)
+                                 || (first_bad != size);
+                    }
+
+                    for (index = 0u; index < size + (2u * BENCH_M4_GUARD); ++index)
+                    {
+                        if ((index < BENCH_M4_GUARD) || (index >= size + BENCH_M4_GUARD))
+                        {
+                            expected = BENCH_M4_GUARD_BYTE;
+                        }
+                        else if ((variant < 2u) || (variant == 4u))
+                        {
+                            expected = source[index - BENCH_M4_GUARD];
+                        }
+                        else
+                        {
+                            expected = 0x5Au;
+                        }
+
+                        if (guard[index] != expected)
+                        {
+                            status = 1;
+                        }
+                    }
+
+                    failures += (uint32_t)status;
+                }
+            }
+        }
+    }
+
+    return failures;
+}
+
+/**
+ *  @fn      benchM4Check
+ *  @package memory_bench
+ *
+ *  @brief   Cross-checks MEM_findByte, MEM_isFilled, MEM_compareStructs, and through benchM4CheckWrites the
+ *           copy and fill kernels, against plain byte loops.
+ *
+ *  @details Sweeps every start offset 0-3, size up to BENCH_M4_CHECK_SIZE and position of the single byte
+ *           that matches (search) or differs (fill check, compare), plus no such byte at all. The search
+ *           filler holds zero and the neighbours of the searched value, which trip a careless zero-byte test.
+ *           Prints "check: N" with N the number of disagreements; returns non-zero when N is not 0.
+ **/
+static int benchM4Check(void)
+{
+    static const uint8_t filler[4] = { 0xA4u, 0x00u, 0xA6u, 0x25u };
+    uint32_t failures = benchM4CheckWrites();
+    size_t start = 0u;
+    size_t size = 0u;
+    size_t position = 0u;
+    size_t index = 0u;
+
+    for (start = 0u; start < 4u; ++start)
+    {
+        for (size = 0u; size <= BENCH_M4_CHECK_SIZE; ++size)
+        {
+            uint8_t *region_a = &bench_source[start];
+            uint8_t *region_b = &bench_destine[start];
+
+            /* position == size places the byte outside the region. */
+            for (position = 0u; position <= size; ++position)
+            {
+                size_t expected = size;
+                size_t offset = size;
+                MEM_struct_search_t found = PATTERN_NOT_FOUND;
+
+                for (index = 0u; index <= size; ++index)
+                {
+                    region_a[index] = (index == position) ? 0xA5u : filler[index & 3u];
+                    region_b[index] = (index == position) ? 0x5Bu : 0x5Au;
+                }
+
+                for (index = 0u; index < size; ++index)
+                {
+                    if (region_a[index] == 0xA5u)
+                    {
+                        expected = index;
+                        break;
+                    }
+                }
+
+                found = MEM_findByte(region_a, size, 0xA5u, &offset);
+
+                if ((found != ((expected < size) ? PATTERN_FOUND : PATTERN_NOT_FOUND))
+                    || ((found == PATTERN_FOUND) && (offset != expected)))
+                {
+                    ++failures;
+                }
+
+                offset = 0u;
+
+                if ((MEM_isFilled(region_b, size, 0x5Au, &offset) != ((position < size) ? STRUCT_NOT_FILLED
+                                                                                         : STRUCT_FILLED))
+                    || (offset != position))
+                {
+                    ++failures;
+                }
+
+                for (index = 0u; index <= size; ++index)
+                {
+                    region_a[index] = (uint8_t)(index * 7u);
+                    region_b[index] = (index == position) ? (uint8_t)~region_a[index] : region_a[index];
+                }
+
+                if (MEM_compareStructs(region_a, region_b, size) != ((position < size) ? STRUCTS_ARENT_EQUAL
+                                                                                        : STRUCTS_ARE_EQUAL))
+                {
+                    ++failures;
+                }
+            }
+        }
+    }
+
+    benchM4PrintValue("check", failures);
+
+    return (failures != 0u);
+}
+
+/**
+ *  @fn      benchM4Run
+ *  @package memory_bench
+ *
+ *  @brief   Parses "kernel size [offset [mismatch]]" and runs the kernel once; returns non-zero on a malformed
+ *           command line.
+ **/
+static int benchM4Run(const char *command)
+{
+    const char *cursor = command;
+    size_t size = 0u;
+    size_t offset = 0u;
+    size_t mismatch = 0u;
+    uint8_t *source = bench_source;
+    uint8_t *destine = bench_destine;
+    int bound_only = 0;
+    int call = 0;
+    int baseline = 0;
+    MEM_stats_op_t operation = MEM_STATS_OP_COUNT;
+    size_t found = 0u;
+    int scan = 0;
+    int status_out = 0;
+#if defined(BENCH_M4_CYCLES)
+    uint32_t start = 0u;
+#endif
+
+    /* Both prefixes are always tested, so the two runs only part ways right before the call. */
+    call = benchM4Prefix(command, "call ");
+    baseline = benchM4Prefix(command, "none ");
+
+    if ((call | baseline) != 0)
+    {
+        command += 5;
+        cursor = command;
+    }
+
+    if (benchM4Matches(command, "check") != 0)
+    {
+        return benchM4Check();
+    }
+
+    if (benchM4Matches(command, "bound") != 0)
+    {
+        bound_only = 1;
+        command += 6;
+        cursor = command;
+    }
+
+    if (benchM4Matches(command, "copy") != 0)
+    {
+        operation = MEM_STATS_COPY;
+    }
+    else if (benchM4Matches(command, "fill") != 0)
+    {
+        operation = MEM_STATS_FILL;
+    }
+    else if (benchM4Matches(command, "compare") != 0)
+    {
+        operation = MEM_STATS_COMPARE;
+    }
+    else if ((bound_only == 0) && (benchM4Matches(command, "find") != 0))
+    {
+        scan = BENCH_M4_SCAN_FIND;
+    }
+    else if ((bound_only == 0) && (benchM4Matches(command, "filled") != 0))
+    {
+        scan = BENCH_M4_SCAN_FILLED;
+    }
+    else
+    {
+        return 1;
+    }
+
+    while ((*cursor != ' ') && (*cursor != '\0'))
+    {
+        ++cursor;
+    }
+
+    while (*cursor == ' ')
+    {
+        ++cursor;
+    }
+
+    while ((*cursor >= '0') && (*cursor <= '9'))
+    {
+        size = (size * 10u) + (size_t)(*cursor - '0');
+        ++cursor;
+    }
+
+    while (*cursor == ' ')
+    {
+        ++cursor;
+    }
+
+    while ((*cursor >= '0') && (*cursor <= '9'))
+    {
+        offset = (offset * 10u) + (size_t)(*cursor - '0');
+        ++cursor;
+    }
+
+    while (*cursor == ' ')
+    {
+        ++cursor;
+    }
+
+    while ((*cursor >= '0') && (*cursor <= '9'))
+    {
+        mismatch = (mismatch * 10u) + (size_t)(*cursor - '0');
+        ++cursor;
+    }
+
+    if ((size > BENCH_M4_MAX_SIZE) || (offset > 3u) || (mismatch > size))
+    {
+        return 1;
+    }
+
+    /* Both buffers are 8-byte aligned; the same offset keeps them co-aligned. */
+    source += offset;
+    destine += offset;
+
+    if (mismatch != 0u)
+    {
+        destine[mismatch - 1u] = 0xFFu;
+    }
+
+    if (bound_only != 0)
+    {
+        benchM4PrintValue("bound", MEM_cycleBound(operation, size, (offset == 0u) ? MEM_STATS_ALIGNED
+                                                                                  : MEM_STATS_CO_ALIGNED));
+        return 0;
+    }
+
+    if (baseline != 0)
+    {
+        return 0;
+    }
+
+#if defined(BENCH_M4_CYCLES)
+    BENCH_M4_DEMCR |= (1u << 24);
+    BENCH_M4_DWT_CTRL |= 1u;
+    start = MEM_CYCLE_COUNTER();
+#endif
+
+    if (operation == MEM_STATS_COPY)
+    {
+        status_out = (MEM_copyStruct(source, destine, size) != STRUCT_COPIED);
+    }
+    else if (operation == MEM_STATS_FILL)
+    {
+        status_out = (MEM_fillStruct(destine, size, 0x5Au) != STRUCT_FILLED);
+    }
+    else if (operation == MEM_STATS_COMPARE)
+    {
+        /* Both buffers are zero, so without a mismatch the compare scans the whole size. */
+        status_out = (MEM_compareStructs(source, destine, size) != ((mismatch != 0u) ? STRUCTS_ARENT_EQUAL
+                                                                                        : STRUCTS_ARE_EQUAL));
+    }
+    else if (scan == BENCH_M4_SCAN_FIND)
+    {
+        status_out = (MEM_findByte(source, size, 0xA5u, &found) != PATTERN_NOT_FOUND);
+    }
+    else if (scan == BENCH_M4_SCAN_FILLED)
+    {
+        status_out = (MEM_isFilled(source, size, 0u, &found) != STRUCT_FILLED);
+    }
+
+#if defined(BENCH_M4_CYCLES)
+    benchM4PrintValue("cycles", MEM_CYCLE_COUNTER() - start);
+
+    if (operation != MEM_STATS_OP_COUNT)
+    {
+        benchM4PrintValue("bound", MEM_cycleBound(operation, size, (offset == 0u) ? MEM_STATS_ALIGNED
+                                                                                  : MEM_STATS_CO_ALIGNED));
+    }
+#endif
+
+    return status_out;
+}
+
+void benchM4Reset(void)
+{
+    static char command[64];
+    struct
+    {
+        char    *buffer;
+        uint32_t length;
+    } request = { command, (uint32_t)sizeof(command) };
+    volatile uint32_t *bss = __bss_start__;
+
+    while (bss < __bss_end__)
+    {
+        *bss++ = 0u;
+    }
+
+    MEM_ramfuncInit();
+
+    if ((benchM4Semihost(BENCH_M4_SYS_GET_CMDLINE, &request) != 0u) || (benchM4Run(command) != 0))
+    {
+        benchM4Exit(BENCH_M4_EXIT_ERROR);
+    }
+
+    benchM4Exit(BENCH_M4_EXIT_OK);
+}
+
+/*** end of file ***/
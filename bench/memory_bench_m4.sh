@@ -0,0 +1,302 @@
+#!/bin/sh
+#
+#  @file       memory_bench_m4.sh
+#  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+#
+#  @date       16.10.2026
+#
+#  @brief      Cortex-M4 instruction-count benchmark of the MEM_* kernels under qemu-system-arm.
+#
+#  @details
+#              Builds bench/memory_bench_m4.c once per MEM_CONFIG_PROFILE. Every kernel and size runs once
+#              under the libinsn and libmem TCG plugins, as "call <kernel>"; the "none <kernel>" run, which parses
+#              the same command and stops before the call, is subtracted, so the counts cover the kernel call
+#              only. Writes one CSV line per profile, kernel and size to stdout.
+#
+#              The cycle_bound column is MEM_cycleBound for the same call, printed by the image itself. A
+#              Cortex-M4 instruction takes at least one cycle, so instructions above the bound mean the model
+#              in src/memory_wcet.c missed a path; the script reports it on stderr and exits non-zero. The find
+#              and filled rows (MEM_findByte, MEM_isFilled) have no cycle model and leave cycle_bound empty.
+#
+#              A total below the bound says little on its own: the fixed call cost can hide a per-byte cost that
+#              is too low. So each profile is also checked per phase. From PHASE_BASE bytes (aligned), growing
+#              the call by 1, 4 and 32 bytes adds a tail byte, a tail word and a block; the instructions each
+#              step adds must not exceed the cycles it adds to the bound. The byte heads are checked by running
+#              PHASE_BASE + 3 bytes at offsets 1-3 (co-aligned buffers) against the co-aligned bound. The
+#              compare's early exits are checked by placing one differing byte in the last byte, word or burst of
+#              PHASE_BASE and PHASE_BASE + 3 byte compares at offsets 0-3, which runs the back16/back4 rewinds and
+#              the byte rescan. These checks print nothing to stdout and count as violations like the sweep.
+#
+#              Instructions are still not cycles. The model is only validated once a hardware run with
+#              -DBENCH_M4_CYCLES (DWT cycle counts next to the bound) stays below it as well.
+#
+#              Before the sweep, each image runs its "check" command once: the kernels it was built with
+#              (the DSP variants, since -mcpu=cortex-m4 defines __ARM_FEATURE_DSP) must agree with plain byte
+#              loops, or the script stops. The script also stops when the disassembly of a compare/copy/fill
+#              entry point references memcpy, memmove, memset or memcmp: the images are built without
+#              -fno-tree-loop-distribute-patterns, as an application would be, so a kernel byte loop written in
+#              C that GCC turned into a libc call shows up here.
+#
+#              Each profile is also built with MEM_CONFIG_RAMFUNC=1, with .ramfunc linked at the start of data
+#              RAM (0x20000000; qemu loads it there directly, so MEM_ramfuncInit copies it onto itself). That
+#              image must place every compare/copy/fill entry point in data RAM, none of them may branch to an
+#              address outside it (a BL into .text would fetch from flash on hardware), and its "check" command
+#              must pass. Its PHASE_BASE-byte copy, fill and compare, aligned and at offset 3, must stay below
+#              the bound, which adds the long call (WCET_LONG_CALL) in these builds. They are not swept.
+#
+#              bench/memory_bench_m4.csv is a reference run with the default SIZES and PROFILES. It was made
+#              with clang 14 and lld (which ignore long_call and reach .ramfunc through range thunks) on a
+#              Cortex-M4 instruction-set simulator taking qemu's place, so a GCC build counts somewhat
+#              differently. Replace it with a run of the toolchain above when one is available.
+#
+#              Usage, from the repository root:
+#
+#                  QEMU_PLUGIN_DIR=/path/to/qemu/build/tests/plugin bench/memory_bench_m4.sh > m4.csv
+#
+#              Needs arm-none-eabi-gcc (newlib-nano) and qemu-system-arm 8.0 or newer, built with plugin
+#              support. Optional environment: CC, OBJDUMP, NM, QEMU, SIZES, PROFILES, PHASE_BASE, OUT_DIR.
+#
+
+set -eu
+
+CC=${CC:-arm-none-eabi-gcc}
+OBJDUMP=${OBJDUMP:-arm-none-eabi-objdump}
+NM=${NM:-arm-none-eabi-nm}
+QEMU=${QEMU:-qemu-system-arm}
+PLUGINS=${QEMU_PLUGIN_DIR:?set QEMU_PLUGIN_DIR to the directory holding libinsn.so and libmem.so}
+SIZES=${SIZES:-"1 4 16 64 256 1024 4096 16384 65536"}
+PROFILES=${PROFILES:-"SIZE BALANCED SPEED"}
+PHASE_BASE=${PHASE_BASE:-256}
+OUT_DIR=${OUT_DIR:-$(mktemp -d)}
+
+CFLAGS="-mcpu=cortex-m4 -mthumb -mfloat-abi=soft -O2 -std=gnu11 -DNDEBUG -ffreestanding -Iinc -Isrc"
+LDFLAGS="-nostartfiles --specs=nano.specs -Wl,--section-start=.vectors=0x0 -Wl,-Ttext=0x400"
+ENTRY_POINTS="MEM_compareStructs MEM_copyStruct MEM_fillStruct
+              MEM_compareStructsUnchecked MEM_copyStructUnchecked MEM_fillStructUnchecked"
+
+# disassemble <elf>: prints the disassembly of every compare/copy/fill entry point.
+disassemble()
+{
+    for symbol in $ENTRY_POINTS; do
+        "$OBJDUMP" -d --disassemble="$symbol" "$1"
+    done
+}
+
+# arguments <word>...: prints the words as qemu semihosting arguments.
+arguments()
+{
+    printf 'arg=%s,' "$@" | sed 's/,$//'
+}
+
+# count <elf> <kernel> <size> <plugin args> <key> [offset] [mismatch]: prints the total the plugin logs on its last <key>
+# line (libinsn: "insns:", libmem: "mem accesses:"). <kernel> carries the "call" or "none" prefix.
+count()
+{
+    log="$OUT_DIR/plugin.log"
+
+    # shellcheck disable=SC2086
+    "$QEMU" -M mps2-an386 -cpu cortex-m4 -nographic -monitor none -serial none \
+        -semihosting-config "enable=on,target=native,$(arguments $2 "$3" "${6:-0}" "${7:-0}")" \
+        -kernel "$1" -plugin "$4" -d plugin -D "$log"
+
+    grep "$5" "$log" | tail -n 1 | grep -o '[0-9][0-9]*$'
+}
+
+# bound <elf> <kernel> <size> [offset]: prints the MEM_cycleBound the image reports for the call.
+bound()
+{
+    "$QEMU" -M mps2-an386 -cpu cortex-m4 -nographic -monitor none -serial none \
+        -semihosting-config "enable=on,target=native,arg=bound,arg=$2,arg=$3,arg=${4:-0}" -kernel "$1" \
+        | grep "bound:" | grep -o '[0-9][0-9]*$'
+}
+
+# instructions <elf> <kernel> <size> [offset] [mismatch]: prints the instructions of the kernel call alone.
+instructions()
+{
+    echo $(( $(count "$1" "call $2" "$3" "$PLUGINS/libinsn.so" "insns:" "${4:-0}" "${5:-0}") \
+        - $(count "$1" "none $2" "$3" "$PLUGINS/libinsn.so" "insns:" "${4:-0}" "${5:-0}") ))
+}
+
+# phase_check <elf> <profile> <kernel>: prints one line per phase whose instructions exceed its share of the
+# bound, and returns the number of such lines.
+phase_check()
+{
+    failed=0
+    base_insn=$(instructions "$1" "$3" "$PHASE_BASE")
+    base_bound=$(bound "$1" "$3" "$PHASE_BASE")
+
+    for step in 1 4 32; do
+        size=$((PHASE_BASE + step))
+        insn=$(( $(instructions "$1" "$3" "$size") - base_insn ))
+        cycles=$(( $(bound "$1" "$3" "$size") - base_bound ))
+
+        if [ "$insn" -gt "$cycles" ]; then
+            echo "memory_bench_m4: $2 $3 $PHASE_BASE+$step: the step adds $insn instructions but $cycles bound cycles" >&2
+            failed=$((failed + 1))
+        fi
+    done
+
+    size=$((PHASE_BASE + 3))
+
+    for offset in 1 2 3; do
+        insn=$(instructions "$1" "$3" "$size" "$offset")
+        cycles=$(bound "$1" "$3" "$size" "$offset")
+
+        if [ "$insn" -gt "$cycles" ]; then
+            echo "memory_bench_m4: $2 $3 $size at offset $offset: $insn instructions exceed the bound of $cycles cycles" >&2
+            failed=$((failed + 1))
+        fi
+    done
+
+    return "$failed"
+}
+
+# mismatch_check <elf> <profile>: runs compares of PHASE_BASE and PHASE_BASE + 3 bytes at offsets 0-3 whose one
+# differing byte sits in the last byte, word or burst, so the back16/back4 rewinds and the byte rescan run. Prints
+# one line per call whose instructions exceed the bound, and returns the number of such lines.
+mismatch_check()
+{
+    failed=0
+
+    for size in "$PHASE_BASE" $((PHASE_BASE + 3)); do
+        for offset in 0 1 2 3; do
+            cycles=$(bound "$1" compare "$size" "$offset")
+
+            for position in $size $((size - 1)) $((size - 3)) $((size - 4)) $((size - 5)) $((size - 15)) \
+                            $((size - 16)) $((size - 17)); do
+                insn=$(instructions "$1" compare "$size" "$offset" "$position")
+
+                if [ "$insn" -gt "$cycles" ]; then
+                    echo "memory_bench_m4: $2 compare $size at offset $offset, differing at $position: $insn instructions exceed the bound of $cycles cycles" >&2
+                    failed=$((failed + 1))
+                fi
+            done
+        done
+    done
+
+    return "$failed"
+}
+
+# ramfunc_check <elf> <profile>: fails unless the entry points sit in data RAM, branch only within it, pass the
+# image's "check" command and stay below the bound, long call included, on PHASE_BASE bytes at offsets 0 and 3. objdump prints addresses without leading zeros, so a target in data RAM
+# (0x20000000 and up) has eight hex digits and anything shorter is flash.
+ramfunc_check()
+{
+    for symbol in $ENTRY_POINTS; do
+        address=$("$NM" "$1" | awk -v s="$symbol" '$3 == s { print $1 }')
+
+        case "$address" in
+            2???????) ;;
+            *)
+                echo "memory_bench_m4: $2 RAMFUNC: $symbol at 0x${address:-?}, outside data RAM" >&2
+                return 1
+                ;;
+        esac
+    done
+
+    if disassemble "$1" | awk -F '\t' '
+        $3 ~ /^c?b/ && match($4, /[0-9a-f]+ </) && RLENGTH - 2 < 8 { print; bad = 1 }
+        END { exit !bad }' >&2; then
+        echo "memory_bench_m4: $2 RAMFUNC: an entry point branches out of data RAM" >&2
+        return 1
+    fi
+
+    "$QEMU" -M mps2-an386 -cpu cortex-m4 -nographic -monitor none -serial none \
+        -semihosting-config "enable=on,target=native,arg=check" -kernel "$1" >&2 || return 1
+
+    for kernel in copy fill compare; do
+        for offset in 0 3; do
+            insn=$(instructions "$1" "$kernel" "$PHASE_BASE" "$offset")
+            cycles=$(bound "$1" "$kernel" "$PHASE_BASE" "$offset")
+
+            if [ "$insn" -gt "$cycles" ]; then
+                echo "memory_bench_m4: $2 RAMFUNC $kernel $PHASE_BASE at offset $offset: $insn instructions exceed the bound of $cycles cycles" >&2
+                return 1
+            fi
+        done
+    done
+}
+
+cat > "$OUT_DIR/ramfunc.ld" <<'EOF_LD'
+SECTIONS
+{
+    .ramfunc 0x20000000 :
+    {
+        __ramfunc_start__ = .;
+        *(.ramfunc)
+        *(.ramfunc.*)
+        . = ALIGN(4);
+        __ramfunc_end__ = .;
+    }
+    __ramfunc_load__ = LOADADDR(.ramfunc);
+}
+INSERT AFTER .text;
+EOF_LD
+
+for profile in $PROFILES; do
+    elf="$OUT_DIR/memory_bench_m4_${profile}_ramfunc.elf"
+
+    # shellcheck disable=SC2086
+    $CC $CFLAGS -DMEM_CONFIG_PROFILE=MEM_PROFILE_$profile -DMEM_CONFIG_RAMFUNC=1 bench/memory_bench_m4.c \
+        src/memory_ops.c src/memory_wcet.c $LDFLAGS -Wl,-T,"$OUT_DIR/ramfunc.ld" -o "$elf"
+
+    if ! ramfunc_check "$elf" "$profile"; then
+        exit 1
+    fi
+done
+
+violations=0
+
+echo "profile,kernel,size,instructions,loads,stores,instructions_per_byte,loads_per_byte,stores_per_byte,cycle_bound"
+
+for profile in $PROFILES; do
+    elf="$OUT_DIR/memory_bench_m4_$profile.elf"
+
+    # shellcheck disable=SC2086
+    $CC $CFLAGS -DMEM_CONFIG_PROFILE=MEM_PROFILE_$profile bench/memory_bench_m4.c src/memory_ops.c \
+        src/memory_wcet.c $LDFLAGS -o "$elf"
+
+    if disassemble "$elf" | grep -E '<(memcpy|memmove|memset|memcmp)[>+@]' >&2; then
+        echo "memory_bench_m4: $profile: a compare/copy/fill entry point calls into libc" >&2
+        exit 1
+    fi
+
+    if ! "$QEMU" -M mps2-an386 -cpu cortex-m4 -nographic -monitor none -serial none \
+        -semihosting-config "enable=on,target=native,arg=check" -kernel "$elf" >&2; then
+        echo "memory_bench_m4: $profile: kernels disagree with the byte-loop reference" >&2
+        exit 1
+    fi
+
+    for size in $SIZES; do
+        for kernel in copy fill compare find filled; do
+            base_insn=$(count "$elf" "none $kernel" "$size" "$PLUGINS/libinsn.so" "insns:")
+            base_load=$(count "$elf" "none $kernel" "$size" "$PLUGINS/libmem.so,track=r" "mem accesses:")
+            base_store=$(count "$elf" "none $kernel" "$size" "$PLUGINS/libmem.so,track=w" "mem accesses:")
+            insn=$(( $(count "$elf" "call $kernel" "$size" "$PLUGINS/libinsn.so" "insns:") - base_insn ))
+            load=$(( $(count "$elf" "call $kernel" "$size" "$PLUGINS/libmem.so,track=r" "mem accesses:") - base_load ))
+            store=$(( $(count "$elf" "call $kernel" "$size" "$PLUGINS/libmem.so,track=w" "mem accesses:") - base_store ))
+            cycles=
+
+            case "$kernel" in
+                find|filled) ;;
+                *) cycles=$(bound "$elf" "$kernel" "$size") ;;
+            esac
+
+            awk -v p="$profile" -v k="$kernel" -v s="$size" -v i="$insn" -v l="$load" -v w="$store" -v b="$cycles" \
+                'BEGIN { printf "%s,%s,%s,%d,%d,%d,%.3f,%.3f,%.3f,%s\n", p, k, s, i, l, w, i / s, l / s, w / s, b }'
+
+            if [ -n "$cycles" ] && [ "$insn" -gt "$cycles" ]; then
+                echo "memory_bench_m4: $profile $kernel $size: $insn instructions exceed the bound of $cycles cycles" >&2
+                violations=$((violations + 1))
+            fi
+        done
+    done
+
+    for kernel in copy fill compare; do
+        phase_check "$elf" "$profile" "$kernel" || violations=$((violations + $?))
+    done
+
+    mismatch_check "$elf" "$profile" || violations=$((violations + $?))
+done
+
+[ "$violations" -eq 0 ]
@@ -0,0 +1,411 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Host replay of a captured memory_trace dump against one kernel set.
+ *
+ *  @file       memory_replay.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Reads a dump written by MEM_traceDump and issues every recorded call again, back to back, with
+ *              the recorded size and the recorded source/destination offsets within a cache line. The kernel
+ *              set is the one memory_ops.c is compiled with, or memcpy/memset/memcmp with --libc, so one
+ *              binary per MEM_CONFIG_PROFILE compares candidate kernels on the same production-shaped
+ *              workload:
+ *
+ *                  for p in SIZE BALANCED SPEED; do
+ *                      gcc -O2 -std=gnu11 -DMEM_CONFIG_PROFILE=MEM_PROFILE_$p -Iinc -Isrc \
+ *                          bench/memory_replay.c src/memory_ops.c src/memory_stats.c src/memory_trace.c \
+ *                          -o memory_replay_$p
+ *                      ./memory_replay_$p trace.bin
+ *                  done
+ *                  ./memory_replay_BALANCED trace.bin --libc
+ *
+ *              Options: [--libc] [--repeat n] [--ghz freq]. The whole trace is replayed --repeat times (5 by
+ *              default) after one warm-up pass and the fastest pass is reported, in total and per operation.
+ *              Each per-operation line comes from its own pass that replays only that operation. Cycles come
+ *              from the TSC on x86_64 and are derived from the wall clock and --ghz elsewhere.
+ *
+ *  @note
+ *              - The dump does not record the compare outcome; both buffers hold the same bytes, so every
+ *                replayed compare scans its full size. Traces dominated by early-exit compares replay slower
+ *                than they ran.
+ *              - Inter-call gaps are not reproduced: the replay measures the kernels, not the application.
+ *
+ *  @see        - memory_trace.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "memory_ops.h"
+#include "memory_trace.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def REPLAY_REPEATS
+ * @brief Default number of timed passes; the fastest is reported.
+ **/
+#define REPLAY_REPEATS              (5u)
+
+/**
+ * @def REPLAY_FILL_VALUE
+ * @brief Content of both buffers and value written by fills, so compares always scan fully.
+ **/
+#define REPLAY_FILL_VALUE           ((uint8_t)0x5Au)
+
+/**
+ * @def REPLAY_ALL_OPS
+ * @brief Operation filter replaying every record.
+ **/
+#define REPLAY_ALL_OPS              ((unsigned)MEM_STATS_OP_COUNT)
+
+/* =================================
+ *          PRIVATE TYPES          *
+ * ================================*/
+
+/**
+ * @struct replayOptions
+ * @brief Command-line settings.
+ **/
+typedef struct replayOptions
+{
+    const char *trace_path;     /**< Dump written by MEM_traceDump */
+    unsigned    repeats;        /**< Timed passes */
+    double      ghz;            /**< Clock used to derive cycles when there is no TSC */
+    int         libc;           /**< Non-zero: replay against memcpy/memset/memcmp */
+} replayOptions_t;
+
+/**
+ * @struct replayTotals
+ * @brief Best pass of one operation filter.
+ **/
+typedef struct replayTotals
+{
+    uint64_t calls;             /**< Replayed calls */
+    uint64_t bytes;             /**< Replayed bytes */
+    double   ns;                /**< Wall time of the pass */
+    double   cycles;            /**< Cycles of the pass */
+} replayTotals_t;
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Names of the operations, indexed by MEM_stats_op_t.
+ **/
+static const char *const replay_op_names[MEM_STATS_OP_COUNT] =
+{
+    "compare", "copy", "fill"
+};
+
+/**
+ * @brief Keeps the compiler from discarding the replayed calls.
+ **/
+static volatile int replay_sink;
+
+/**
+ *  @fn      replayNowNs
+ *  @package memory_bench
+ *
+ *  @brief   Monotonic wall clock in nanoseconds.
+ **/
+static uint64_t replayNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ *  @fn      replayNowCycles
+ *  @package memory_bench
+ *
+ *  @brief   Cycle counter, or zero when the host has none readable from user space.
+ **/
+static uint64_t replayNowCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return (uint64_t)__rdtsc();
+#else
+    return 0u;
+#endif
+}
+
+/**
+ *  @fn      replayLoad
+ *  @package memory_bench
+ *
+ *  @brief   Reads and validates a dump; returns the records (to be freed) or NULL.
+ **/
+static MEM_trace_record_t *replayLoad(const char *path, MEM_trace_header_t *header)
+{
+    MEM_trace_record_t *records_out = NULL;
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        (void)fprintf(stderr, "memory_replay: cannot open %s\n", path);
+        return NULL;
+    }
+
+    if ((fread(header, sizeof(*header), 1u, file) != 1u) || (header->magic != MEM_TRACE_MAGIC)
+        || (header->version != MEM_TRACE_VERSION) || (header->record_size != sizeof(MEM_trace_record_t)))
+    {
+        (void)fprintf(stderr, "memory_replay: %s is not a version %u trace dump\n", path, MEM_TRACE_VERSION);
+        goto close_file;
+    }
+
+    records_out = (MEM_trace_record_t *)malloc(((size_t)header->count + 1u) * sizeof(MEM_trace_record_t));
+
+    if ((records_out != NULL)
+        && (fread(records_out, sizeof(MEM_trace_record_t), header->count, file) != header->count))
+    {
+        (void)fprintf(stderr, "memory_replay: %s is truncated\n", path);
+        free(records_out);
+        records_out = NULL;
+    }
+
+close_file:
+    (void)fclose(file);
+
+    return records_out;
+}
+
+/**
+ *  @fn      replayCall
+ *  @package memory_bench
+ *
+ *  @brief   Issues one recorded call on the replay buffers.
+ **/
+static void replayCall(const MEM_trace_record_t *record, uint8_t *source, uint8_t *destine, int libc)
+{
+    const uint8_t *from = source + record->src_offset;
+    uint8_t *to = destine + record->dst_offset;
+
+    switch (record->operation)
+    {
+        case MEM_STATS_COMPARE:
+            replay_sink += (libc != 0) ? memcmp(from, to, record->size)
+                                       : (int)MEM_compareStructs(from, to, record->size);
+            break;
+
+        case MEM_STATS_COPY:
+            replay_sink += (libc != 0) ? (memcpy(to, from, record->size) == NULL)
+                                       : (int)MEM_copyStruct(from, to, record->size);
+            break;
+
+        case MEM_STATS_FILL:
+            /* Fills record the same pointer twice; replay it at the destination offset. */
+            replay_sink += (libc != 0) ? (memset(to, REPLAY_FILL_VALUE, record->size) == NULL)
+                                       : (int)MEM_fillStruct(to, record->size, REPLAY_FILL_VALUE);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/**
+ *  @fn      replayRun
+ *  @package memory_bench
+ *
+ *  @brief   Replays the records matching the filter once untimed, then repeats times; keeps the fastest pass.
+ **/
+static replayTotals_t replayRun(const MEM_trace_record_t *records, uint32_t count, unsigned filter,
+                                uint8_t *source, uint8_t *destine, const replayOptions_t *options)
+{
+    replayTotals_t totals_out = { 0u, 0u, 0.0, 0.0 };
+    unsigned pass = 0u;
+    uint32_t index = 0u;
+
+    for (index = 0u; index < count; ++index)
+    {
+        if ((filter == REPLAY_ALL_OPS) || (records[index].operation == filter))
+        {
+            totals_out.calls++;
+            totals_out.bytes += records[index].size;
+        }
+    }
+
+    for (pass = 0u; pass <= options->repeats; ++pass)
+    {
+        const uint64_t start_ns = replayNowNs();
+        const uint64_t start_cycles = replayNowCycles();
+        double ns = 0.0;
+        double cycles = 0.0;
+
+        for (index = 0u; index < count; ++index)
+        {
+            if ((filter == REPLAY_ALL_OPS) || (records[index].operation == filter))
+            {
+                replayCall(&records[index], source, destine, options->libc);
+            }
+        }
+
+        cycles = (double)(replayNowCycles() - start_cycles);
+        ns = (double)(replayNowNs() - start_ns);
+
+        if (cycles == 0.0)
+        {
+            cycles = ns * options->ghz;
+        }
+
+        /* Pass 0 is the warm-up: it faults the pages in and trains the branch predictors. */
+        if ((pass == 1u) || ((pass > 1u) && (ns < totals_out.ns)))
+        {
+            totals_out.ns = ns;
+            totals_out.cycles = cycles;
+        }
+    }
+
+    return totals_out;
+}
+
+/**
+ *  @fn      replayParse
+ *  @package memory_bench
+ *
+ *  @brief   Parses the command line; returns non-zero on an unknown or incomplete option.
+ **/
+static int replayParse(int argc, char **argv, replayOptions_t *options)
+{
+    int index = 1;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if ((strcmp(argv[index], "--repeat") == 0) && (index + 1 < argc))
+        {
+            options->repeats = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--ghz") == 0) && (index + 1 < argc))
+        {
+            options->ghz = strtod(argv[++index], NULL);
+        }
+        else if (strcmp(argv[index], "--libc") == 0)
+        {
+            options->libc = 1;
+        }
+        else if ((argv[index][0] != '-') && (options->trace_path == NULL))
+        {
+            options->trace_path = argv[index];
+        }
+        else
+        {
+            options->trace_path = NULL;
+            break;
+        }
+    }
+
+    if (options->trace_path == NULL)
+    {
+        (void)fprintf(stderr, "usage: %s trace.bin [--libc] [--repeat n] [--ghz freq]\n", argv[0]);
+        return 1;
+    }
+
+    if (options->repeats == 0u)
+    {
+        options->repeats = 1u;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    replayOptions_t options = { NULL, REPLAY_REPEATS, 1.0, 0 };
+    MEM_trace_header_t header;
+    MEM_trace_record_t *records = NULL;
+    uint8_t *source = NULL;
+    uint8_t *destine = NULL;
+    size_t max_size = 0u;
+    uint32_t index = 0u;
+    unsigned op = 0u;
+    int status_out = EXIT_SUCCESS;
+
+    if (replayParse(argc, argv, &options) != 0)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    records = replayLoad(options.trace_path, &header);
+
+    if (records == NULL)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    for (index = 0u; index < header.count; ++index)
+    {
+        if (records[index].size > max_size)
+        {
+            max_size = records[index].size;
+        }
+    }
+
+    /* Room for the largest call at the largest offset, rounded to whole lines for aligned_alloc. */
+    max_size = ((max_size + MEM_TRACE_LINE - 1u) & ~(size_t)(MEM_TRACE_LINE - 1u)) + MEM_TRACE_LINE;
+
+    source = (uint8_t *)aligned_alloc(MEM_TRACE_LINE, max_size);
+    destine = (uint8_t *)aligned_alloc(MEM_TRACE_LINE, max_size);
+
+    if ((source == NULL) || (destine == NULL))
+    {
+        (void)fprintf(stderr, "memory_replay: cannot allocate 2 x %zu bytes\n", max_size);
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    (void)memset(source, REPLAY_FILL_VALUE, max_size);
+    (void)memset(destine, REPLAY_FILL_VALUE, max_size);
+
+    (void)printf("trace: %s, %u records (%u dropped before the dump), kernels: %s\n", options.trace_path,
+                 header.count, header.dropped, (options.libc != 0) ? "libc" : "MEM_*");
+    (void)printf("%-10s %10s %14s %14s %14s %12s\n", "operation", "calls", "bytes", "cycles", "ns",
+                 "cycles/call");
+
+    for (op = 0u; op <= REPLAY_ALL_OPS; ++op)
+    {
+        const replayTotals_t totals = replayRun(records, header.count, op, source, destine, &options);
+
+        (void)printf("%-10s %10llu %14llu %14.0f %14.0f %12.1f\n",
+                     (op == REPLAY_ALL_OPS) ? "total" : replay_op_names[op], (unsigned long long)totals.calls,
+                     (unsigned long long)totals.bytes, totals.cycles, totals.ns,
+                     (totals.calls != 0u) ? (totals.cycles / (double)totals.calls) : 0.0);
+    }
+
+release:
+    free(source);
+    free(destine);
+    free(records);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
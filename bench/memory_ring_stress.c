@@ -0,0 +1,391 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Host stress test of the SPSC ring: one producer, one consumer, every record checked in order.
+ *
+ *  @file       memory_ring_stress.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The producer queues records 0, 1, 2, ... and fills every word of record k with k. The consumer
+ *              checks that every record it dequeues holds one value in all its words and that the values
+ *              arrive as 0, 1, 2, ... with no gap, repeat or reordering. A mismatch is counted as an error and
+ *              makes the run fail.
+ *
+ *              Both sides mix single and batch calls. The batch sizes come from a fixed pseudo-random
+ *              sequence and go up to twice the capacity, so batches are cut short by a full or empty ring and
+ *              their copies wrap at the end of the storage. Before the threads start, head and tail are set
+ *              to the same value just below 2^32, so the free-running counters wrap within the first
+ *              --start-gap records and the head - tail arithmetic is exercised across the wrap.
+ *
+ *              Build and run from the repository root:
+ *
+ *                  gcc -O2 -std=gnu11 -pthread -Iinc -Isrc bench/memory_ring_stress.c src/memory_ring.c \
+ *                      -o memory_ring_stress
+ *                  ./memory_ring_stress [--records n] [--capacity n] [--words n] [--start-gap n]
+ *
+ *              Sanitizer builds use the same line with -O1 -g and -fsanitize=address,undefined, or
+ *              -fsanitize=thread -Wno-tsan (gcc warns that it does not instrument the fence in MEM_ringInit).
+ *              Unlike the snapshot stress test this one needs no suppression: every record copy is ordered by
+ *              the acquire/release pair on head and tail, so ThreadSanitizer must report nothing.
+ *              On a single core the threads rarely interleave inside a copy, so a release store moved above its
+ *              copy may still pass the plain build; the ThreadSanitizer build reports it as a race.
+ *
+ *  @see        - memory_ring.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory_ring.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def STRESS_RECORDS
+ * @brief Default number of records passed from the producer to the consumer.
+ **/
+#define STRESS_RECORDS              (4000000u)
+
+/**
+ * @def STRESS_CAPACITY
+ * @brief Default ring capacity in records; a power of two.
+ **/
+#define STRESS_CAPACITY             (64u)
+
+/**
+ * @def STRESS_WORDS
+ * @brief Default record size in 32-bit words.
+ **/
+#define STRESS_WORDS                (4u)
+
+/**
+ * @def STRESS_START_GAP
+ * @brief Default distance of the initial head and tail from the 2^32 wrap.
+ **/
+#define STRESS_START_GAP            (1000u)
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Ring under test, its storage and the run settings, set before the threads start.
+ **/
+static MEM_ring_t stress_ring;
+static uint32_t *stress_storage;
+static uint32_t stress_records = STRESS_RECORDS;
+static uint32_t stress_capacity = STRESS_CAPACITY;
+static size_t stress_words = STRESS_WORDS;
+static uint32_t stress_start_gap = STRESS_START_GAP;
+
+/**
+ * @brief Results of the consumer, read after it is joined.
+ **/
+static uint64_t stress_errors;
+static uint64_t stress_single_calls;
+static uint64_t stress_batch_calls;
+
+/**
+ *  @fn      stressNext
+ *  @package memory_bench
+ *
+ *  @brief   Steps a xorshift32 state; each thread owns its state, so the batch sizes are reproducible.
+ **/
+static uint32_t stressNext(uint32_t *state)
+{
+    uint32_t value = *state;
+
+    value ^= value << 13;
+    value ^= value >> 17;
+    value ^= value << 5;
+    *state = value;
+
+    return value;
+}
+
+/**
+ *  @fn      stressProducer
+ *  @package memory_bench
+ *
+ *  @brief   Queues records 0 .. stress_records - 1, in single pushes and batches of 1 .. 2 * capacity.
+ **/
+static void *stressProducer(void *argument)
+{
+    const size_t batch_max = 2u * (size_t)stress_capacity;
+    uint32_t *records = (uint32_t *)malloc(batch_max * stress_words * sizeof(uint32_t));
+    uint32_t state = 0x9E3779B9u;
+    uint32_t next = 0u;
+    size_t count = 0u;
+    size_t pushed = 0u;
+    size_t index = 0u;
+    size_t word = 0u;
+
+    (void)argument;
+
+    if (records == NULL)
+    {
+        /* The consumer would wait forever for the records. */
+        (void)fprintf(stderr, "memory_ring_stress: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (next < stress_records)
+    {
+        count = (size_t)(stressNext(&state) % (uint32_t)batch_max) + 1u;
+
+        if (count > (size_t)(stress_records - next))
+        {
+            count = (size_t)(stress_records - next);
+        }
+
+        for (index = 0u; index < count; ++index)
+        {
+            for (word = 0u; word < stress_words; ++word)
+            {
+                records[(index * stress_words) + word] = next + (uint32_t)index;
+            }
+        }
+
+        if ((count == 1u) || ((stressNext(&state) & 3u) == 0u))
+        {
+            /* Single pushes; a full ring is retried on the same record. */
+            for (index = 0u; index < count; ++index)
+            {
+                while (MEM_ringPush(&stress_ring, &records[index * stress_words]) == RING_FULL)
+                {
+                    sched_yield();
+                }
+            }
+
+            pushed = count;
+        }
+        else
+        {
+            pushed = 0u;
+            (void)MEM_ringPushBatch(&stress_ring, records, count, &pushed);
+
+            if (pushed == 0u)
+            {
+                sched_yield();
+            }
+        }
+
+        next += (uint32_t)pushed;
+    }
+
+    free(records);
+
+    return NULL;
+}
+
+/**
+ *  @fn      stressCheck
+ *  @package memory_bench
+ *
+ *  @brief   Checks that record holds expected in every word.
+ **/
+static void stressCheck(const uint32_t *record, uint32_t expected)
+{
+    size_t word = 0u;
+
+    for (word = 0u; word < stress_words; ++word)
+    {
+        if (record[word] != expected)
+        {
+            ++stress_errors;
+            return;
+        }
+    }
+}
+
+/**
+ *  @fn      stressConsumer
+ *  @package memory_bench
+ *
+ *  @brief   Dequeues until every record arrived, in single pops and batches of 1 .. 2 * capacity.
+ **/
+static void *stressConsumer(void *argument)
+{
+    const size_t batch_max = 2u * (size_t)stress_capacity;
+    uint32_t *records = (uint32_t *)malloc(batch_max * stress_words * sizeof(uint32_t));
+    uint32_t state = 0x7F4A7C15u;
+    uint32_t expected = 0u;
+    size_t count = 0u;
+    size_t popped = 0u;
+    size_t index = 0u;
+
+    (void)argument;
+
+    if (records == NULL)
+    {
+        /* The producer would wait forever for free slots. */
+        (void)fprintf(stderr, "memory_ring_stress: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    while (expected < stress_records)
+    {
+        count = (size_t)(stressNext(&state) % (uint32_t)batch_max) + 1u;
+
+        if ((stressNext(&state) & 3u) == 0u)
+        {
+            ++stress_single_calls;
+
+            if (MEM_ringPop(&stress_ring, records) == RING_OK)
+            {
+                stressCheck(records, expected++);
+            }
+            else
+            {
+                sched_yield();
+            }
+
+            continue;
+        }
+
+        ++stress_batch_calls;
+        popped = 0u;
+        (void)MEM_ringPopBatch(&stress_ring, records, count, &popped);
+
+        for (index = 0u; index < popped; ++index)
+        {
+            stressCheck(&records[index * stress_words], expected++);
+        }
+
+        if (popped == 0u)
+        {
+            sched_yield();
+        }
+    }
+
+    /* The producer stops at stress_records, so nothing may be left behind. */
+    if (MEM_ringCount(&stress_ring) != 0u)
+    {
+        ++stress_errors;
+    }
+
+    free(records);
+
+    return NULL;
+}
+
+/**
+ *  @fn      stressParse
+ *  @package memory_bench
+ *
+ *  @brief   Parses the command line; returns non-zero on an unknown or incomplete option.
+ **/
+static int stressParse(int argc, char **argv)
+{
+    int index = 1;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if ((strcmp(argv[index], "--records") == 0) && (index + 1 < argc))
+        {
+            stress_records = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--capacity") == 0) && (index + 1 < argc))
+        {
+            stress_capacity = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--words") == 0) && (index + 1 < argc))
+        {
+            stress_words = (size_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--start-gap") == 0) && (index + 1 < argc))
+        {
+            stress_start_gap = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [--records n] [--capacity n] [--words n] [--start-gap n]\n",
+                          argv[0]);
+            return 1;
+        }
+    }
+
+    if ((stress_words == 0u) || (stress_capacity == 0u) || (stress_capacity > 65536u))
+    {
+        (void)fprintf(stderr, "memory_ring_stress: --words must be positive and --capacity 1-65536\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    pthread_t producer;
+    pthread_t consumer;
+    int status_out = EXIT_SUCCESS;
+
+    if (stressParse(argc, argv) != 0)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    stress_storage = (uint32_t *)calloc((size_t)stress_capacity * stress_words, sizeof(uint32_t));
+
+    if ((stress_storage == NULL)
+        || (MEM_ringInit(&stress_ring, stress_storage, stress_words * sizeof(uint32_t), stress_capacity)
+            != RING_OK))
+    {
+        (void)fprintf(stderr, "memory_ring_stress: cannot set up a ring of %u %zu-word records "
+                      "(the capacity must be a power of two)\n", stress_capacity, stress_words);
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    /* Both counters start just below the wrap; only their difference matters to the ring. */
+    stress_ring.head = 0u - stress_start_gap;
+    stress_ring.tail = 0u - stress_start_gap;
+
+    if ((pthread_create(&consumer, NULL, stressConsumer, NULL) != 0)
+        || (pthread_create(&producer, NULL, stressProducer, NULL) != 0))
+    {
+        (void)fprintf(stderr, "memory_ring_stress: cannot start the threads\n");
+        exit(EXIT_FAILURE);
+    }
+
+    (void)pthread_join(producer, NULL);
+    (void)pthread_join(consumer, NULL);
+
+    (void)printf("%u records of %zu words through %u slots, counters wrapped %s: %llu single and %llu batch "
+                 "pops, %llu errors\n",
+                 stress_records, stress_words, stress_capacity,
+                 (stress_ring.head < (0u - stress_start_gap)) ? "yes" : "no",
+                 (unsigned long long)stress_single_calls, (unsigned long long)stress_batch_calls,
+                 (unsigned long long)stress_errors);
+
+    if (stress_errors != 0u)
+    {
+        status_out = EXIT_FAILURE;
+    }
+
+release:
+    free(stress_storage);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
@@ -0,0 +1,349 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Host stress test of the snapshot publisher: one writer, N readers, no torn copy accepted.
+ *
+ *  @file       memory_snapshot_stress.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The writer publishes self-consistent values: publish number k sets every word of the payload to
+ *              k. Each reader loops on MEM_snapshotRead (or MEM_snapshotTryRead with --try) and checks that every
+ *              word of its copy holds the same value, and that the values it sees never go backwards. A copy
+ *              that mixes two publishes, or an older publish after a newer one, is counted as a tear and makes
+ *              the run fail.
+ *
+ *              --unsafe makes the readers copy the payload with a plain memcpy and no sequence check. The run
+ *              is then expected to report tears, which shows the checker detects them on this host. On a single
+ *              core a copy is only interrupted when it spans a time slice, so use a large payload there, e.g.
+ *              --unsafe --words 65536 --publishes 20000.
+ *
+ *              Build and run from the repository root:
+ *
+ *                  gcc -O2 -std=gnu11 -pthread -Iinc -Isrc bench/memory_snapshot_stress.c src/memory_snapshot.c \
+ *                      -o memory_snapshot_stress
+ *                  ./memory_snapshot_stress [--readers n] [--words n] [--publishes n] [--try] [--unsafe]
+ *
+ *              Sanitizer builds use the same line with -O1 -g and -fsanitize=address,undefined, or
+ *              -fsanitize=thread -Wno-tsan. ThreadSanitizer does not model the fences the sequence check relies
+ *              on (gcc warns about them, hence -Wno-tsan), so it reports the payload copies as races.
+ *              __tsan_default_suppressions below silences races whose top frame is memcpy, i.e. the payload
+ *              copies, and nothing else: a plain (non-atomic) access to the sequence counter is still reported.
+ *
+ *  @see        - memory_snapshot.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "memory_snapshot.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def STRESS_READERS
+ * @brief Default number of reader threads.
+ **/
+#define STRESS_READERS              (4u)
+
+/**
+ * @def STRESS_MAX_READERS
+ * @brief Upper bound of --readers.
+ **/
+#define STRESS_MAX_READERS          (64u)
+
+/**
+ * @def STRESS_WORDS
+ * @brief Default payload size in 32-bit words.
+ **/
+#define STRESS_WORDS                (64u)
+
+/**
+ * @def STRESS_PUBLISHES
+ * @brief Default number of publishes.
+ **/
+#define STRESS_PUBLISHES            (2000000u)
+
+/* =================================
+ *          PRIVATE TYPES          *
+ * ================================*/
+
+/**
+ * @struct stressReader
+ * @brief State and results of one reader thread.
+ **/
+typedef struct stressReader
+{
+    pthread_t thread;           /**< Reader thread */
+    uint64_t  reads;            /**< Copies accepted and checked */
+    uint64_t  torn_reads;       /**< MEM_snapshotTryRead attempts that reported SNAPSHOT_TORN */
+    uint64_t  tears;            /**< Accepted copies that were torn or went backwards */
+} stressReader_t;
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Snapshot under test, its storage and the run settings, set before the threads start.
+ **/
+static MEM_snapshot_t stress_snapshot;
+static uint32_t *stress_storage;
+static size_t stress_words = STRESS_WORDS;
+static uint32_t stress_publishes = STRESS_PUBLISHES;
+static int stress_try;
+static int stress_unsafe;
+
+/**
+ * @brief Set by the writer after its last publish.
+ **/
+static uint32_t stress_done;
+
+/**
+ *  @fn      __tsan_default_suppressions
+ *  @package memory_bench
+ *
+ *  @brief   ThreadSanitizer hook: silences the payload copy races the sequence check is designed to absorb.
+ **/
+const char *__tsan_default_suppressions(void);
+
+const char *__tsan_default_suppressions(void)
+{
+    return "race:memcpy\n";
+}
+
+/**
+ *  @fn      stressWriter
+ *  @package memory_bench
+ *
+ *  @brief   Publishes 1 .. stress_publishes, each as a payload whose every word holds the publish number.
+ **/
+static void *stressWriter(void *argument)
+{
+    uint32_t *value = (uint32_t *)malloc(stress_words * sizeof(uint32_t));
+    uint32_t publish = 0u;
+    size_t word = 0u;
+
+    (void)argument;
+
+    if (value != NULL)
+    {
+        for (publish = 1u; publish <= stress_publishes; ++publish)
+        {
+            for (word = 0u; word < stress_words; ++word)
+            {
+                value[word] = publish;
+            }
+
+            (void)MEM_snapshotPublish(&stress_snapshot, value);
+        }
+    }
+
+    free(value);
+    __atomic_store_n(&stress_done, 1u, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+/**
+ *  @fn      stressReader
+ *  @package memory_bench
+ *
+ *  @brief   Reads until the writer is done, checking every accepted copy.
+ **/
+static void *stressReader(void *argument)
+{
+    stressReader_t *reader = (stressReader_t *)argument;
+    uint32_t *copy = (uint32_t *)malloc(stress_words * sizeof(uint32_t));
+    uint32_t last = 0u;
+    size_t word = 0u;
+    int done = 0;
+
+    if (copy == NULL)
+    {
+        ++reader->tears;
+        return NULL;
+    }
+
+    while (done == 0)
+    {
+        /* Sampled before the read, so the copy after the writer finished is still checked. */
+        done = (__atomic_load_n(&stress_done, __ATOMIC_ACQUIRE) != 0u);
+
+        if (stress_unsafe != 0)
+        {
+            (void)memcpy(copy, stress_storage, stress_words * sizeof(uint32_t));
+        }
+        else if (stress_try != 0)
+        {
+            if (MEM_snapshotTryRead(&stress_snapshot, copy) != SNAPSHOT_OK)
+            {
+                ++reader->torn_reads;
+                continue;
+            }
+        }
+        else
+        {
+            (void)MEM_snapshotRead(&stress_snapshot, copy);
+        }
+
+        ++reader->reads;
+
+        for (word = 1u; word < stress_words; ++word)
+        {
+            if (copy[word] != copy[0])
+            {
+                break;
+            }
+        }
+
+        if ((word != stress_words) || (copy[0] < last))
+        {
+            ++reader->tears;
+        }
+
+        last = copy[0];
+    }
+
+    free(copy);
+
+    return NULL;
+}
+
+/**
+ *  @fn      stressParse
+ *  @package memory_bench
+ *
+ *  @brief   Parses the command line; returns non-zero on an unknown or incomplete option.
+ **/
+static int stressParse(int argc, char **argv, unsigned *readers)
+{
+    int index = 1;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if ((strcmp(argv[index], "--readers") == 0) && (index + 1 < argc))
+        {
+            *readers = (unsigned)strtoul(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--words") == 0) && (index + 1 < argc))
+        {
+            stress_words = (size_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--publishes") == 0) && (index + 1 < argc))
+        {
+            stress_publishes = (uint32_t)strtoul(argv[++index], NULL, 0);
+        }
+        else if (strcmp(argv[index], "--try") == 0)
+        {
+            stress_try = 1;
+        }
+        else if (strcmp(argv[index], "--unsafe") == 0)
+        {
+            stress_unsafe = 1;
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [--readers n] [--words n] [--publishes n] [--try] [--unsafe]\n",
+                          argv[0]);
+            return 1;
+        }
+    }
+
+    if ((*readers == 0u) || (*readers > STRESS_MAX_READERS) || (stress_words == 0u))
+    {
+        (void)fprintf(stderr, "memory_snapshot_stress: --readers must be 1-%u and --words positive\n",
+                      STRESS_MAX_READERS);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    static stressReader_t readers[STRESS_MAX_READERS];
+    pthread_t writer;
+    unsigned reader_count = STRESS_READERS;
+    unsigned index = 0u;
+    uint64_t reads = 0u;
+    uint64_t torn_reads = 0u;
+    uint64_t tears = 0u;
+    int status_out = EXIT_SUCCESS;
+
+    if (stressParse(argc, argv, &reader_count) != 0)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    stress_storage = (uint32_t *)calloc(stress_words, sizeof(uint32_t));
+
+    if ((stress_storage == NULL)
+        || (MEM_snapshotInit(&stress_snapshot, stress_storage, stress_words * sizeof(uint32_t)) != SNAPSHOT_OK))
+    {
+        (void)fprintf(stderr, "memory_snapshot_stress: cannot set up a %zu-word snapshot\n", stress_words);
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    for (index = 0u; index < reader_count; ++index)
+    {
+        if (pthread_create(&readers[index].thread, NULL, stressReader, &readers[index]) != 0)
+        {
+            (void)fprintf(stderr, "memory_snapshot_stress: cannot start reader %u\n", index);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (pthread_create(&writer, NULL, stressWriter, NULL) != 0)
+    {
+        (void)fprintf(stderr, "memory_snapshot_stress: cannot start the writer\n");
+        exit(EXIT_FAILURE);
+    }
+
+    (void)pthread_join(writer, NULL);
+
+    for (index = 0u; index < reader_count; ++index)
+    {
+        (void)pthread_join(readers[index].thread, NULL);
+        reads += readers[index].reads;
+        torn_reads += readers[index].torn_reads;
+        tears += readers[index].tears;
+    }
+
+    (void)printf("%u publishes of %zu words, %u readers (%s): %llu copies checked, %llu torn attempts "
+                 "rejected, %llu tears accepted\n",
+                 stress_publishes, stress_words, reader_count,
+                 (stress_unsafe != 0) ? "unsafe memcpy" : ((stress_try != 0) ? "MEM_snapshotTryRead"
+                                                                            : "MEM_snapshotRead"),
+                 (unsigned long long)reads, (unsigned long long)torn_reads, (unsigned long long)tears);
+
+    if (tears != 0u)
+    {
+        status_out = EXIT_FAILURE;
+    }
+
+release:
+    free(stress_storage);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
@@ -0,0 +1,491 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_bench
+ *  @{
+ *
+ *  @package    memory_bench
+ *  @brief      Host benchmark of the worst-case latency of MEM_tlsfMalloc/MEM_tlsfFree against glibc malloc/free.
+ *
+ *  @file       memory_tlsf_bench.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Generates one fragmentation-heavy trace and replays it on both allocators. The trace toggles
+ *              random slots of a table of live blocks: an empty slot gets a new block, a live one is freed. Sizes
+ *              are mixed (70% 8-256 B, 25% 256 B-4 KiB, 5% 4-64 KiB), so the frees leave holes of every size
+ *              between long-lived neighbours and the heap stays fragmented for the whole run.
+ *
+ *              Every call is timed on its own with the monotonic clock; the cost of reading the clock is
+ *              measured first and subtracted. Each allocator replays the trace once untimed (the glibc arena
+ *              grows and the TLSF region is faulted in), then once timed; --cold times the first replay
+ *              instead. The report gives the median, the 99.9th percentile and the maximum latency of malloc
+ *              and free for each allocator. A real-time allocator is judged on the last two columns.
+ *
+ *              Build and run from the repository root:
+ *
+ *                  gcc -O2 -std=gnu11 -Iinc -Isrc bench/memory_tlsf_bench.c src/memory_tlsf.c -o memory_tlsf_bench
+ *                  ./memory_tlsf_bench [--ops n] [--slots n] [--heap bytes] [--seed n] [--cold]
+ *
+ *              Pin the process (taskset -c 2) and run it on an idle machine: the maximum of a million calls
+ *              also catches the interrupts and page faults of the host, for both allocators alike.
+ *
+ *  @see        - memory_tlsf.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "memory_tlsf.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def BENCH_TLSF_OPS
+ * @brief Default number of calls in the trace.
+ **/
+#define BENCH_TLSF_OPS              ((size_t)1000000u)
+
+/**
+ * @def BENCH_TLSF_SLOTS
+ * @brief Default number of live-block slots; about half of them are live at any time.
+ **/
+#define BENCH_TLSF_SLOTS            ((size_t)8192u)
+
+/**
+ * @def BENCH_TLSF_HEAP
+ * @brief Default size of the TLSF region (256 MiB).
+ **/
+#define BENCH_TLSF_HEAP             ((size_t)256u << 20)
+
+/**
+ * @def BENCH_TLSF_TIMER_PROBES
+ * @brief Back-to-back clock reads used to measure the cost of a clock read.
+ **/
+#define BENCH_TLSF_TIMER_PROBES     (10000u)
+
+/* =================================
+ *          PRIVATE TYPES          *
+ * ================================*/
+
+/**
+ * @struct benchTlsfOp
+ * @brief One call of the trace.
+ **/
+typedef struct benchTlsfOp
+{
+    uint32_t slot;              /**< Slot of the block */
+    uint32_t size;              /**< Bytes to allocate, 0 for a free */
+} benchTlsfOp_t;
+
+/**
+ * @struct benchTlsfOptions
+ * @brief Command-line settings.
+ **/
+typedef struct benchTlsfOptions
+{
+    size_t   ops;               /**< Calls in the trace */
+    size_t   slots;             /**< Live-block slots */
+    size_t   heap;              /**< TLSF region size */
+    uint64_t seed;              /**< Trace seed */
+    int      cold;              /**< Non-zero: time the first replay */
+} benchTlsfOptions_t;
+
+/**
+ * @struct benchTlsfLatency
+ * @brief Latencies of one replay, in nanoseconds, split by call type.
+ **/
+typedef struct benchTlsfLatency
+{
+    uint32_t *malloc_ns;        /**< One entry per malloc */
+    uint32_t *free_ns;          /**< One entry per free */
+    size_t    malloc_count;     /**< Entries in malloc_ns */
+    size_t    free_count;       /**< Entries in free_ns */
+    size_t    failed;           /**< Mallocs that returned NULL */
+} benchTlsfLatency_t;
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Control block of the TLSF allocator under test.
+ **/
+static MEM_tlsf_t bench_tlsf;
+
+/**
+ * @brief Cost of one clock read, subtracted from every sample.
+ **/
+static uint64_t bench_timer_ns;
+
+/**
+ *  @fn      benchNowNs
+ *  @package memory_bench
+ *
+ *  @brief   Monotonic wall clock in nanoseconds.
+ **/
+static inline uint64_t benchNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec;
+}
+
+/**
+ *  @fn      benchTimerCost
+ *  @package memory_bench
+ *
+ *  @brief   Smallest difference between two back-to-back clock reads.
+ **/
+static uint64_t benchTimerCost(void)
+{
+    uint64_t cost_out = UINT64_MAX;
+    unsigned probe = 0u;
+
+    for (probe = 0u; probe < BENCH_TLSF_TIMER_PROBES; ++probe)
+    {
+        const uint64_t start = benchNowNs();
+        const uint64_t delta = benchNowNs() - start;
+
+        if (delta < cost_out)
+        {
+            cost_out = delta;
+        }
+    }
+
+    return cost_out;
+}
+
+/**
+ *  @fn      benchRandom
+ *  @package memory_bench
+ *
+ *  @brief   xorshift64* generator, so the trace only depends on the seed.
+ **/
+static uint64_t benchRandom(uint64_t *state)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+    return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ *  @fn      benchTraceSize
+ *  @package memory_bench
+ *
+ *  @brief   Draws an allocation size: 70% 8-256 B, 25% 256 B-4 KiB, 5% 4-64 KiB.
+ **/
+static uint32_t benchTraceSize(uint64_t *state)
+{
+    const uint64_t draw = benchRandom(state);
+    const unsigned bucket = (unsigned)(draw % 100u);
+    const uint32_t spread = (uint32_t)(draw >> 32);
+
+    if (bucket < 70u)
+    {
+        return 8u + (spread % 249u);
+    }
+
+    if (bucket < 95u)
+    {
+        return 256u + (spread % 3841u);
+    }
+
+    return 4096u + (spread % 61441u);
+}
+
+/**
+ *  @fn      benchTraceBuild
+ *  @package memory_bench
+ *
+ *  @brief   Generates the trace; returns NULL when it cannot be allocated.
+ **/
+static benchTlsfOp_t *benchTraceBuild(const benchTlsfOptions_t *options)
+{
+    benchTlsfOp_t *trace_out = (benchTlsfOp_t *)malloc(options->ops * sizeof(*trace_out));
+    uint8_t *live = (uint8_t *)calloc(options->slots, 1u);
+    uint64_t state = (options->seed != 0u) ? options->seed : 1u;
+    size_t index = 0u;
+
+    if ((trace_out == NULL) || (live == NULL))
+    {
+        free(trace_out);
+        free(live);
+        return NULL;
+    }
+
+    for (index = 0u; index < options->ops; ++index)
+    {
+        const uint32_t slot = (uint32_t)(benchRandom(&state) % options->slots);
+
+        trace_out[index].slot = slot;
+        trace_out[index].size = (live[slot] != 0u) ? 0u : benchTraceSize(&state);
+        live[slot] = (uint8_t)(live[slot] ^ 1u);
+    }
+
+    free(live);
+
+    return trace_out;
+}
+
+/**
+ *  @fn      benchReplay
+ *  @package memory_bench
+ *
+ *  @brief   Replays the trace on TLSF (use_tlsf != 0) or glibc, recording the latency of every call.
+ *
+ *  @details A malloc that fails leaves its slot empty, and the matching free of the trace is then skipped.
+ *           The first byte of every block is written outside the timed window, as a user of the block would.
+ *           The blocks still live at the end are released untimed.
+ **/
+static void benchReplay(const benchTlsfOp_t *trace, const benchTlsfOptions_t *options, void **blocks,
+                        int use_tlsf, benchTlsfLatency_t *latency)
+{
+    size_t index = 0u;
+
+    latency->malloc_count = 0u;
+    latency->free_count = 0u;
+    latency->failed = 0u;
+
+    for (index = 0u; index < options->ops; ++index)
+    {
+        const benchTlsfOp_t *op = &trace[index];
+        uint64_t start = 0u;
+        uint64_t elapsed = 0u;
+
+        if (op->size != 0u)
+        {
+            void *block = NULL;
+
+            start = benchNowNs();
+            block = (use_tlsf != 0) ? MEM_tlsfMalloc(&bench_tlsf, op->size) : malloc(op->size);
+            elapsed = benchNowNs() - start;
+
+            if (block == NULL)
+            {
+                ++latency->failed;
+            }
+            else
+            {
+                *(volatile uint8_t *)block = (uint8_t)index;
+            }
+
+            blocks[op->slot] = block;
+            latency->malloc_ns[latency->malloc_count++] =
+                (elapsed > bench_timer_ns) ? (uint32_t)(elapsed - bench_timer_ns) : 0u;
+        }
+        else if (blocks[op->slot] != NULL)
+        {
+            start = benchNowNs();
+
+            if (use_tlsf != 0)
+            {
+                (void)MEM_tlsfFree(&bench_tlsf, blocks[op->slot]);
+            }
+            else
+            {
+                free(blocks[op->slot]);
+            }
+
+            elapsed = benchNowNs() - start;
+
+            blocks[op->slot] = NULL;
+            latency->free_ns[latency->free_count++] =
+                (elapsed > bench_timer_ns) ? (uint32_t)(elapsed - bench_timer_ns) : 0u;
+        }
+    }
+
+    for (index = 0u; index < options->slots; ++index)
+    {
+        if (blocks[index] != NULL)
+        {
+            if (use_tlsf != 0)
+            {
+                (void)MEM_tlsfFree(&bench_tlsf, blocks[index]);
+            }
+            else
+            {
+                free(blocks[index]);
+            }
+
+            blocks[index] = NULL;
+        }
+    }
+}
+
+/**
+ *  @fn      benchCompareU32
+ *  @package memory_bench
+ *
+ *  @brief   qsort comparator of uint32_t, ascending.
+ **/
+static int benchCompareU32(const void *left, const void *right)
+{
+    const uint32_t a = *(const uint32_t *)left;
+    const uint32_t b = *(const uint32_t *)right;
+
+    return (a > b) - (a < b);
+}
+
+/**
+ *  @fn      benchReport
+ *  @package memory_bench
+ *
+ *  @brief   Sorts one latency array and prints its median, 99.9th percentile and maximum.
+ **/
+static void benchReport(const char *allocator, const char *call, uint32_t *samples, size_t count, size_t failed)
+{
+    size_t p999 = 0u;
+
+    if (count == 0u)
+    {
+        (void)printf("%-8s %-7s %10zu %8zu %10s %10s %10s\n", allocator, call, count, failed, "-", "-", "-");
+        return;
+    }
+
+    qsort(samples, count, sizeof(samples[0]), benchCompareU32);
+
+    /* Nearest-rank percentile: the smallest sample with at least 99.9% of the samples at or below it. */
+    p999 = ((count * 999u) + 999u) / 1000u;
+
+    (void)printf("%-8s %-7s %10zu %8zu %10u %10u %10u\n", allocator, call, count, failed, samples[(count - 1u) / 2u],
+                 samples[p999 - 1u], samples[count - 1u]);
+}
+
+/**
+ *  @fn      benchParse
+ *  @package memory_bench
+ *
+ *  @brief   Parses the command line; returns non-zero on an unknown or incomplete option.
+ **/
+static int benchParse(int argc, char **argv, benchTlsfOptions_t *options)
+{
+    int index = 1;
+
+    for (index = 1; index < argc; ++index)
+    {
+        if ((strcmp(argv[index], "--ops") == 0) && (index + 1 < argc))
+        {
+            options->ops = (size_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--slots") == 0) && (index + 1 < argc))
+        {
+            options->slots = (size_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--heap") == 0) && (index + 1 < argc))
+        {
+            options->heap = (size_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if ((strcmp(argv[index], "--seed") == 0) && (index + 1 < argc))
+        {
+            options->seed = (uint64_t)strtoull(argv[++index], NULL, 0);
+        }
+        else if (strcmp(argv[index], "--cold") == 0)
+        {
+            options->cold = 1;
+        }
+        else
+        {
+            (void)fprintf(stderr, "usage: %s [--ops n] [--slots n] [--heap bytes] [--seed n] [--cold]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if ((options->ops == 0u) || (options->slots == 0u) || (options->slots > UINT32_MAX))
+    {
+        (void)fprintf(stderr, "memory_tlsf_bench: --ops and --slots must be positive\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    benchTlsfOptions_t options = { BENCH_TLSF_OPS, BENCH_TLSF_SLOTS, BENCH_TLSF_HEAP, 1u, 0 };
+    benchTlsfLatency_t latency = { NULL, NULL, 0u, 0u, 0u };
+    benchTlsfOp_t *trace = NULL;
+    void **blocks = NULL;
+    void *region = NULL;
+    int allocator = 0;
+    int status_out = EXIT_SUCCESS;
+
+    if (benchParse(argc, argv, &options) != 0)
+    {
+        status_out = EXIT_FAILURE;
+        goto return_status;
+    }
+
+    trace = benchTraceBuild(&options);
+    blocks = (void **)calloc(options.slots, sizeof(*blocks));
+    latency.malloc_ns = (uint32_t *)malloc(options.ops * sizeof(uint32_t));
+    latency.free_ns = (uint32_t *)malloc(options.ops * sizeof(uint32_t));
+    region = aligned_alloc(64u, options.heap);
+
+    if ((trace == NULL) || (blocks == NULL) || (latency.malloc_ns == NULL) || (latency.free_ns == NULL)
+        || (region == NULL))
+    {
+        (void)fprintf(stderr, "memory_tlsf_bench: out of memory\n");
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    /* Faults the region in, so neither replay of TLSF pays for first-touch page faults. */
+    (void)memset(region, 0, options.heap);
+
+    if ((MEM_tlsfInit(&bench_tlsf) != TLSF_OK) || (MEM_tlsfAddRegion(&bench_tlsf, region, options.heap) != TLSF_OK))
+    {
+        (void)fprintf(stderr, "memory_tlsf_bench: cannot add a %zu-byte region\n", options.heap);
+        status_out = EXIT_FAILURE;
+        goto release;
+    }
+
+    bench_timer_ns = benchTimerCost();
+
+    (void)printf("trace: %zu calls, %zu slots, seed %llu, %s replay; clock read %llu ns subtracted\n",
+                 options.ops, options.slots, (unsigned long long)options.seed, (options.cold != 0) ? "cold" : "warm",
+                 (unsigned long long)bench_timer_ns);
+    (void)printf("%-8s %-7s %10s %8s %10s %10s %10s\n", "alloc", "call", "calls", "failed", "p50 ns", "p99.9 ns",
+                 "max ns");
+
+    for (allocator = 1; allocator >= 0; --allocator)
+    {
+        const char *name = (allocator != 0) ? "TLSF" : "glibc";
+
+        if (options.cold == 0)
+        {
+            benchReplay(trace, &options, blocks, allocator, &latency);
+        }
+
+        benchReplay(trace, &options, blocks, allocator, &latency);
+        benchReport(name, "malloc", latency.malloc_ns, latency.malloc_count, latency.failed);
+        benchReport(name, "free", latency.free_ns, latency.free_count, 0u);
+    }
+
+release:
+    free(trace);
+    free(blocks);
+    free(latency.malloc_ns);
+    free(latency.free_ns);
+    free(region);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
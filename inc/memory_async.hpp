@@ -0,0 +1,427 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_async
+ *  @{
+ *
+ *  @package    memory_async
+ *  @brief      C++20 coroutine awaitables that run large MEM_* operations in chunks on a host executor.
+ *
+ *  @file       memory_async.hpp
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              co_await mem::copy_async(dst, src, n) splits the buffer into fixed-size chunks and hands them to
+ *              up to executor.concurrency() workers. Each worker claims the next chunk with a single atomic
+ *              increment and runs the matching MEM_* kernel on it; the worker that finishes last resumes the
+ *              awaiting coroutine with the operation status. The stop token is checked before every chunk, so a
+ *              cancelled operation stops within one chunk per worker.
+ *
+ *              Key functionalities include:
+ *              - **mem::copy_async**: Chunked MEM_copyStruct.
+ *              - **mem::fill_async**: Chunked MEM_fillStruct.
+ *              - **mem::equal_async**: Chunked MEM_compareStructs; stops at the first differing chunk.
+ *              - **mem::thread_pool**: Minimal executor; mem::default_executor() is a process-wide instance.
+ *
+ *  @note
+ *              - The coroutine resumes on an executor thread, not on the thread that suspended it.
+ *              - A cancelled copy or fill leaves the destination partially written and yields
+ *                STRUCT_NOT_COPIED / STRUCT_NOT_FILLED; a cancelled compare yields STRUCTS_COMPARE_ERROR.
+ *              - Buffers must stay alive until the co_await completes.
+ *              - GCC 12 and older may destroy a braced temporary inside a co_await operand twice; pass
+ *                async_options as a named variable rather than {...} in the co_await expression.
+ *              - Host only: this header needs threads and is not meant for the Cortex-M4 build.
+ *
+ *  @see        - memory_ops.hpp
+ **/
+
+#ifndef MEMORY_ASYNC_HPP_
+#define MEMORY_ASYNC_HPP_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "memory_ops.h"
+
+namespace mem
+{
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @brief Default chunk size: large enough to amortize scheduling, small enough to cancel promptly.
+ **/
+inline constexpr std::size_t default_chunk_size = 64u * 1024u;
+
+/**
+ * @class executor
+ * @brief Where chunk workers run. post() may be called from any thread.
+ **/
+class executor
+{
+public:
+    virtual ~executor() = default;
+
+    virtual void post(std::function<void()> task) = 0;
+
+    virtual std::size_t concurrency() const noexcept = 0;
+};
+
+/**
+ * @class thread_pool
+ * @brief Fixed set of worker threads sharing one FIFO queue. Destruction drains the queue, then joins.
+ **/
+class thread_pool final : public executor
+{
+public:
+    explicit thread_pool(std::size_t threads = std::thread::hardware_concurrency())
+    {
+        threads = std::max<std::size_t>(threads, 1u);
+        workers_.reserve(threads);
+
+        for (std::size_t index = 0u; index < threads; ++index)
+        {
+            workers_.emplace_back([this](std::stop_token stop) { run(stop); });
+        }
+    }
+
+    ~thread_pool() override
+    {
+        for (std::jthread &worker : workers_)
+        {
+            worker.request_stop();
+        }
+    }
+
+    thread_pool(const thread_pool &) = delete;
+    thread_pool &operator=(const thread_pool &) = delete;
+
+    void post(std::function<void()> task) override
+    {
+        {
+            std::lock_guard<std::mutex> guard(lock_);
+            queue_.push_back(std::move(task));
+        }
+
+        wake_.notify_one();
+    }
+
+    std::size_t concurrency() const noexcept override
+    {
+        return workers_.size();
+    }
+
+private:
+    void run(std::stop_token stop)
+    {
+        for (;;)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock<std::mutex> guard(lock_);
+
+                wake_.wait(guard, stop, [this] { return !queue_.empty(); });
+
+                if (queue_.empty())
+                {
+                    return;
+                }
+
+                task = std::move(queue_.front());
+                queue_.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    std::mutex                        lock_;
+    std::condition_variable_any       wake_;
+    std::deque<std::function<void()>> queue_;
+    std::vector<std::jthread>         workers_;
+};
+
+/**
+ *  @fn      mem::default_executor
+ *  @brief   Process-wide thread_pool with one worker per hardware thread, created on first use.
+ **/
+inline executor &default_executor()
+{
+    static thread_pool pool;
+
+    return pool;
+}
+
+/**
+ * @struct async_options
+ * @brief Per-call settings; the defaults run on default_executor() without cancellation.
+ **/
+struct async_options
+{
+    executor        *exec       = nullptr;              /**< nullptr selects default_executor() */
+    std::stop_token  stop       = {};                   /**< Checked before every chunk */
+    std::size_t      chunk_size = default_chunk_size;   /**< Rounded down to a multiple of 64 bytes */
+};
+
+/* =================================
+ *        PRIVATE KERNELS          *
+ * ================================*/
+
+namespace detail
+{
+
+enum class async_kind : std::uint8_t
+{
+    copy,
+    fill,
+    equal
+};
+
+/**
+ * @brief Awaitable shared by the three operations. Lives in the awaiting coroutine's frame for the whole
+ *        suspension, so the workers reference it directly.
+ **/
+template <typename Status, async_kind Kind>
+class [[nodiscard]] async_operation
+{
+public:
+    async_operation(void *destine, const void *source, std::uint8_t value, std::size_t size,
+                    const async_options &options) noexcept
+        : destine_(static_cast<std::uint8_t *>(destine)),
+          source_(static_cast<const std::uint8_t *>(source)),
+          value_(value),
+          size_(size),
+          stop_(options.stop),
+          exec_(options.exec)
+    {
+        chunk_size_ = std::max<std::size_t>(options.chunk_size & ~static_cast<std::size_t>(63u), 64u);
+        chunks_     = (size_ + chunk_size_ - 1u) / chunk_size_;
+        status_.store(static_cast<int>(ok_status()), std::memory_order_relaxed);
+    }
+
+    async_operation(const async_operation &) = delete;
+    async_operation &operator=(const async_operation &) = delete;
+
+    bool await_ready() const noexcept
+    {
+        return (destine_ == nullptr) || (source_ == nullptr) || (size_ == 0u);
+    }
+
+    bool await_suspend(std::coroutine_handle<> continuation)
+    {
+        executor         &exec  = (exec_ != nullptr) ? *exec_ : default_executor();
+        const std::size_t slots = std::clamp<std::size_t>(exec.concurrency(), 1u, chunks_);
+        std::size_t       posted = 0u;
+
+        continuation_ = continuation;
+        workers_left_.store(slots, std::memory_order_relaxed);
+
+        try
+        {
+            for (; posted < slots; ++posted)
+            {
+                exec.post([this] { work(); });
+            }
+        }
+        catch (...)
+        {
+            if (posted == 0u)
+            {
+                throw;
+            }
+
+            /* Posted workers still cover every chunk; only the resume duty has to be settled. */
+            const std::size_t missing = slots - posted;
+
+            if (workers_left_.fetch_sub(missing, std::memory_order_acq_rel) != missing)
+            {
+                return true;
+            }
+
+            settle();
+            return false;
+        }
+
+        return true;
+    }
+
+    Status await_resume() const noexcept
+    {
+        if ((destine_ == nullptr) || (source_ == nullptr))
+        {
+            return bad_address_status();
+        }
+
+        return static_cast<Status>(status_.load(std::memory_order_acquire));
+    }
+
+private:
+    static constexpr Status ok_status() noexcept
+    {
+        if constexpr (Kind == async_kind::copy)  { return STRUCT_COPIED; }
+        if constexpr (Kind == async_kind::fill)  { return STRUCT_FILLED; }
+        if constexpr (Kind == async_kind::equal) { return STRUCTS_ARE_EQUAL; }
+    }
+
+    static constexpr Status cancelled_status() noexcept
+    {
+        if constexpr (Kind == async_kind::copy)  { return STRUCT_NOT_COPIED; }
+        if constexpr (Kind == async_kind::fill)  { return STRUCT_NOT_FILLED; }
+        if constexpr (Kind == async_kind::equal) { return STRUCTS_COMPARE_ERROR; }
+    }
+
+    static constexpr Status bad_address_status() noexcept
+    {
+        if constexpr (Kind == async_kind::copy)  { return COPY_BAD_ADDRESS; }
+        if constexpr (Kind == async_kind::fill)  { return FILL_BAD_ADDRESS; }
+        if constexpr (Kind == async_kind::equal) { return COMPARE_BAD_ADDRESS; }
+    }
+
+    Status run_chunk(std::size_t offset, std::size_t length) const noexcept
+    {
+        if constexpr (Kind == async_kind::copy)
+        {
+            return MEM_copyStruct(source_ + offset, destine_ + offset, length);
+        }
+        else if constexpr (Kind == async_kind::fill)
+        {
+            return MEM_fillStruct(destine_ + offset, length, value_);
+        }
+        else
+        {
+            return MEM_compareStructs(source_ + offset, destine_ + offset, length);
+        }
+    }
+
+    void work() noexcept
+    {
+        for (;;)
+        {
+            if (stop_.stop_requested() || failed_.load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            const std::size_t index = next_.fetch_add(1u, std::memory_order_relaxed);
+
+            if (index >= chunks_)
+            {
+                break;
+            }
+
+            const std::size_t offset = index * chunk_size_;
+            const Status      result = run_chunk(offset, std::min(chunk_size_, size_ - offset));
+
+            if (result != ok_status())
+            {
+                /* First failure wins; the other workers stop before their next chunk. */
+                int expected = static_cast<int>(ok_status());
+
+                (void)status_.compare_exchange_strong(expected, static_cast<int>(result),
+                                                      std::memory_order_relaxed);
+                failed_.store(true, std::memory_order_relaxed);
+                break;
+            }
+
+            done_.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        if (workers_left_.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        {
+            finish();
+        }
+    }
+
+    void settle() noexcept
+    {
+        if (!failed_.load(std::memory_order_relaxed) && (done_.load(std::memory_order_relaxed) != chunks_))
+        {
+            status_.store(static_cast<int>(cancelled_status()), std::memory_order_relaxed);
+        }
+    }
+
+    void finish() noexcept
+    {
+        settle();
+        continuation_.resume();
+    }
+
+    std::uint8_t            *destine_;
+    const std::uint8_t      *source_;
+    std::uint8_t             value_;
+    std::size_t              size_;
+    std::stop_token          stop_;
+    executor                *exec_;
+    std::size_t              chunk_size_ = 0u;
+    std::size_t              chunks_     = 0u;
+    std::coroutine_handle<>  continuation_;
+    std::atomic<std::size_t> next_{0u};
+    std::atomic<std::size_t> done_{0u};
+    std::atomic<std::size_t> workers_left_{0u};
+    std::atomic<bool>        failed_{false};
+    std::atomic<int>         status_{0};
+};
+
+} /* namespace detail */
+
+/* =================================
+ *        PUBLIC FUNCTIONS         *
+ * ================================*/
+
+/**
+ *  @fn      mem::copy_async
+ *  @brief   Awaitable chunked copy of size bytes from source to destine.
+ *  @return  MEM_struct_copy_t once awaited.
+ **/
+inline detail::async_operation<MEM_struct_copy_t, detail::async_kind::copy>
+copy_async(void *destine, const void *source, std::size_t size, const async_options &options = {}) noexcept
+{
+    return {destine, source, 0u, size, options};
+}
+
+/**
+ *  @fn      mem::fill_async
+ *  @brief   Awaitable chunked fill of size bytes of destine with value.
+ *  @return  MEM_struct_fill_t once awaited.
+ **/
+inline detail::async_operation<MEM_struct_fill_t, detail::async_kind::fill>
+fill_async(void *destine, std::uint8_t value, std::size_t size, const async_options &options = {}) noexcept
+{
+    return {destine, destine, value, size, options};
+}
+
+/**
+ *  @fn      mem::equal_async
+ *  @brief   Awaitable chunked byte-wise comparison of size bytes.
+ *  @return  MEM_struct_compare_t once awaited.
+ **/
+inline detail::async_operation<MEM_struct_compare_t, detail::async_kind::equal>
+equal_async(const void *struct_a, const void *struct_b, std::size_t size, const async_options &options = {}) noexcept
+{
+    /* The comparison never writes; destine_ is only read through it. */
+    return {const_cast<void *>(struct_b), struct_a, 0u, size, options};
+}
+
+} /* namespace mem */
+
+#endif /* #ifndef MEMORY_ASYNC_HPP_ */
+/**@}*/
@@ -0,0 +1,194 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_atomic
+ *  @{
+ *
+ *  @package    memory_atomic
+ *  @brief      Tear-free copies of small shared structures (8 and 16 bytes) without a critical section.
+ *
+ *  @file       memory_atomic.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The shared side of every copy must be naturally aligned to its size; the private side may have
+ *              any alignment. The functions follow MEM_copyStruct's argument order and status codes.
+ *
+ *              Cortex-M4: ARMv7-M has no LDREXD/STREXD, so the 8-byte pair is built from what it does have and
+ *              is tear-free in one direction only. MEM_atomicStore64 is a single STRD, which is not single-copy
+ *              atomic: an interrupt taken between its two word writes sees a half-written pair.
+ *              MEM_atomicLoad64 opens an exclusive access with LDREX on the low word, loads the high word and
+ *              closes with STREX of the unchanged low word; the core clears the exclusive monitor on every
+ *              exception entry and return, so a failing STREX means an interrupt ran in the middle of the load
+ *              and the load is retried. The STREX writes the low word back, so the shared location must be
+ *              writable. The pair is therefore tear-free when every store runs at a higher priority than every
+ *              load (an ISR stores, a lower-priority context loads); MEM_ATOMIC_IS_ISR_TO_TASK reports that
+ *              guarantee and MEM_ATOMIC_IS_LOCK_FREE reports 0 for 8 bytes. Use memory_snapshot.h when a load
+ *              can preempt a store.
+ *
+ *              x86_64: 8-byte copies are plain __atomic accesses. 16-byte copies use LOCK CMPXCHG16B and are
+ *              available when the compiler targets it (-mcx16).
+ *
+ *              Ordering: every load is an acquire and every store a release, on both targets (DMB after the
+ *              load and before the store on ARM), so a flag or payload published before a store is visible to
+ *              the context that loads it.
+ *
+ *              Key functionalities include:
+ *              - **MEM_atomicLoad64** / **MEM_atomicStore64**: 8-byte tear-free copies.
+ *              - **MEM_atomicLoad128** / **MEM_atomicStore128**: 16-byte tear-free copies, where lock-free.
+ *              - **MEM_ATOMIC_IS_LOCK_FREE**: Compile-time check of a size class, in every direction.
+ *              - **MEM_ATOMIC_IS_ISR_TO_TASK**: Compile-time check of a size class, ISR stores and task loads.
+ *
+ *  @see        - memory_atomic.h
+ **/
+
+#ifndef MEMORY_ATOMIC_H_
+#define MEMORY_ATOMIC_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory_ops.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *          PUBLIC DEFINES         *
+ * ================================*/
+
+/**
+ * @def MEM_ATOMIC_MAX_LOCK_FREE
+ * @brief Largest size, in bytes, that this target can copy tear-free without a lock, whatever the priorities
+ *        of the storing and the loading context.
+ **/
+#if defined(__x86_64__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+#define MEM_ATOMIC_MAX_LOCK_FREE    (16u)
+#elif defined(__arm__)
+#define MEM_ATOMIC_MAX_LOCK_FREE    (4u)
+#else
+#define MEM_ATOMIC_MAX_LOCK_FREE    (8u)
+#endif
+
+/**
+ * @def MEM_ATOMIC_MAX_ISR_TO_TASK
+ * @brief Largest size, in bytes, that this target can copy tear-free when every store runs at a higher
+ *        priority than every load (an ISR stores, a task loads).
+ **/
+#if (MEM_ATOMIC_MAX_LOCK_FREE > 8u)
+#define MEM_ATOMIC_MAX_ISR_TO_TASK  MEM_ATOMIC_MAX_LOCK_FREE
+#else
+#define MEM_ATOMIC_MAX_ISR_TO_TASK  (8u)
+#endif
+
+/**
+ * @def MEM_ATOMIC_SIZE_CLASS
+ * @brief Evaluates to 1 when the size is one of the copy sizes this module knows (1, 2, 4, 8 or 16 bytes).
+ **/
+#define MEM_ATOMIC_SIZE_CLASS(size)                                                     \
+    (((size) == 1u) || ((size) == 2u) || ((size) == 4u) || ((size) == 8u) || ((size) == 16u))
+
+/**
+ * @def MEM_ATOMIC_IS_LOCK_FREE
+ * @brief Evaluates to 1 when objects of the given size can be copied tear-free without a lock in every
+ *        direction, 0 otherwise. Usable in static assertions only: MEM_ATOMIC_IS_LOCK_FREE(sizeof(my_t)).
+ **/
+#define MEM_ATOMIC_IS_LOCK_FREE(size)                                                   \
+    (MEM_ATOMIC_SIZE_CLASS(size) && ((size) <= MEM_ATOMIC_MAX_LOCK_FREE))
+
+/**
+ * @def MEM_ATOMIC_IS_ISR_TO_TASK
+ * @brief Evaluates to 1 when objects of the given size can be copied tear-free as long as no load ever
+ *        preempts a store, 0 otherwise. Usable in static assertions only.
+ **/
+#define MEM_ATOMIC_IS_ISR_TO_TASK(size)                                                 \
+    (MEM_ATOMIC_SIZE_CLASS(size) && ((size) <= MEM_ATOMIC_MAX_ISR_TO_TASK))
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_atomicLoad64
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 8 bytes out of a shared location without tearing, with acquire ordering.
+ *
+ *  @details On ARM the closing STREX writes the low word back unchanged, so the shared location must be
+ *           writable, and the load is tear-free only against stores at a higher priority.
+ *
+ *  @param   source  [in]  : Shared location, 8-byte aligned and writable on ARM.
+ *  @param   destine [out] : Private destination, any alignment.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+MEM_struct_copy_t MEM_atomicLoad64(const volatile void *source, void *destine);
+
+/**
+ *  @fn      MEM_atomicStore64
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 8 bytes into a shared location without tearing, with release ordering.
+ *
+ *  @details On ARM the store is a single STRD, which an interrupt can split; no load may preempt it.
+ *
+ *  @param   source  [in]  : Private source, any alignment.
+ *  @param   destine [out] : Shared location, 8-byte aligned.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+MEM_struct_copy_t MEM_atomicStore64(const void *source, volatile void *destine);
+
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+
+/**
+ *  @fn      MEM_atomicLoad128
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 16 bytes out of a shared location without tearing.
+ *
+ *  @details CMPXCHG16B always performs a locked write cycle, so the shared location must be writable.
+ *
+ *  @param   source  [in]  : Shared location, 16-byte aligned and writable.
+ *  @param   destine [out] : Private destination, any alignment.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+MEM_struct_copy_t MEM_atomicLoad128(const volatile void *source, void *destine);
+
+/**
+ *  @fn      MEM_atomicStore128
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 16 bytes into a shared location without tearing.
+ *
+ *  @param   source  [in]  : Private source, any alignment.
+ *  @param   destine [out] : Shared location, 16-byte aligned.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+MEM_struct_copy_t MEM_atomicStore128(const void *source, volatile void *destine);
+
+#endif /* #if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_ATOMIC_H_ */
+/**@}*/
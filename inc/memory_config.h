@@ -0,0 +1,172 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_config
+ *  @{
+ *
+ *  @package    memory_config
+ *  @brief      Compile-time configuration of the memory_ops kernels.
+ *
+ *  @file       memory_config.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              MEM_CONFIG_PROFILE selects the kernel set behind MEM_compareStructs, MEM_copyStruct and
+ *              MEM_fillStruct. Define it on the compiler command line (-DMEM_CONFIG_PROFILE=MEM_PROFILE_SIZE);
+ *              the default is MEM_PROFILE_BALANCED.
+ *
+ *              | Profile  | Kernels                      | copy        | compare     | fill        | loop    | code |
+ *              |----------|------------------------------|-------------|-------------|-------------|---------|------|
+ *              | SIZE     | byte loops                   | 9.0 (4.00)  | 11.0 (6.00) | 7.0 (3.00)  | 4/6/3   | 214  |
+ *              | BALANCED | 4-word copy, word cmp/fill   | 1.0 (0.31)  | 3.25 (2.00) | 2.25 (1.25) | 5/8/5   | 738  |
+ *              | SPEED    | 8-word copy/fill, 4-word cmp | 0.75 (0.16) | 1.38 (0.69) | 0.47 (0.13) | 5/11/4  | 930  |
+ *
+ *              Columns copy/compare/fill give steady-state cycles per byte for word-aligned buffers: the per-byte
+ *              slope of MEM_cycleBound (Cortex-M4 TRM timings, zero-wait-state memory), not yet confirmed by a
+ *              -DBENCH_M4_CYCLES run on hardware; flash wait states and bus contention add to them. In
+ *              parentheses, the instructions per byte measured by bench/memory_bench_m4.sh at 65536 bytes
+ *              (bench/memory_bench_m4.csv). "loop" counts the instructions in the inner copy/compare/fill loops;
+ *              the SPEED compare loop has 13 without the DSP extension. "code" is the .text bytes of the
+ *              six compare/copy/fill entry points, checked and unchecked, built with -O2 -DNDEBUG for Cortex-M4
+ *              by clang 14 (all of memory_ops.o: 7204, 8624 and 9058 bytes). BALANCED and SPEED carry head/tail
+ *              byte loops and a word loop next to their bursts, and SPEED also saves and restores the
+ *              callee-saved registers its bursts use.
+ *
+ *              The *Unchecked entry points skip the NULL checks. With NDEBUG undefined they assert instead.
+ *
+ *              MEM_CONFIG_RAMFUNC=1 links the compare/copy/fill entry points (checked and unchecked) into the
+ *              .ramfunc section so they execute from SRAM/CCM without flash wait states. The kernels are inlined
+ *              into those entry points and their head/tail byte loops are assembly, so GCC cannot turn them into
+ *              memcpy/memset calls. With NDEBUG defined and MEM_CONFIG_STATS/MEM_CONFIG_TRACE at 0 the entry
+ *              points therefore make no call at all; the asserts of the *Unchecked variants and the stats/trace
+ *              hooks do call code in flash. bench/memory_bench_m4.sh builds every profile this way and fails if
+ *              an entry point lands outside RAM or branches out of it. Callers reach them through long calls,
+ *              since SRAM is out of BL range of flash. Add
+ *              ld/memory_ramfunc.ld to the linker script and call MEM_ramfuncInit() from the reset handler before
+ *              any kernel runs, or list *(.ramfunc*) inside the .data output section and let the existing .data
+ *              copy load it. To confirm the placement on a cross build:
+ *
+ *                  arm-none-eabi-gcc -mcpu=cortex-m4 -mthumb -O2 -DMEM_CONFIG_RAMFUNC=1 ... -Wl,-Map=app.map
+ *                  arm-none-eabi-nm -n app.elf | grep MEM_copyStruct     (address inside the RAM region)
+ *                  arm-none-eabi-objdump -h app.elf                      (.ramfunc: VMA in RAM, LMA in flash)
+ *
+ *  @see        - memory_ops.h
+ **/
+
+#ifndef MEMORY_CONFIG_H_
+#define MEMORY_CONFIG_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <assert.h>
+#include <stdint.h>
+
+/* =================================
+ *          PUBLIC DEFINES         *
+ * ================================*/
+
+/**
+ * @def MEM_PROFILE_SIZE
+ * @brief Byte loops only: smallest code, slowest kernels.
+ **/
+#define MEM_PROFILE_SIZE            (0)
+
+/**
+ * @def MEM_PROFILE_BALANCED
+ * @brief Word loops and four-word bursts.
+ **/
+#define MEM_PROFILE_BALANCED        (1)
+
+/**
+ * @def MEM_PROFILE_SPEED
+ * @brief Eight-word bursts for copy and fill, four-word bursts for compare.
+ **/
+#define MEM_PROFILE_SPEED           (2)
+
+/**
+ * @def MEM_CONFIG_PROFILE
+ * @brief Kernel set compiled into memory_ops.c.
+ **/
+#ifndef MEM_CONFIG_PROFILE
+#define MEM_CONFIG_PROFILE          MEM_PROFILE_BALANCED
+#endif
+
+#if (MEM_CONFIG_PROFILE != MEM_PROFILE_SIZE) && (MEM_CONFIG_PROFILE != MEM_PROFILE_BALANCED) \
+    && (MEM_CONFIG_PROFILE != MEM_PROFILE_SPEED)
+#error "MEM_CONFIG_PROFILE must be MEM_PROFILE_SIZE, MEM_PROFILE_BALANCED or MEM_PROFILE_SPEED"
+#endif
+
+/**
+ * @def MEM_CONFIG_RAMFUNC
+ * @brief Set to 1 to place the hot kernels in .ramfunc (ARM builds only).
+ **/
+#ifndef MEM_CONFIG_RAMFUNC
+#define MEM_CONFIG_RAMFUNC          (0)
+#endif
+
+/**
+ * @def MEM_RAMFUNC
+ * @brief Placement attribute of the hot kernels: .ramfunc section and long calls, or nothing.
+ **/
+#if defined(__arm__) && (MEM_CONFIG_RAMFUNC != 0)
+#define MEM_RAMFUNC                 __attribute__((section(".ramfunc"), long_call, noinline))
+#else
+#define MEM_RAMFUNC
+#endif
+
+/**
+ * @def MEM_CYCLE_COUNTER
+ * @brief Hook returning a free-running 32-bit cycle count. Defaults to DWT->CYCCNT on ARM, which the
+ *        application must have enabled (DEMCR.TRCENA, DWT_CTRL.CYCCNTENA), to the low half of the TSC on x86
+ *        and to 0 elsewhere. Define it to read another timer, e.g. -DMEM_CYCLE_COUNTER()=TIM2->CNT.
+ **/
+#ifndef MEM_CYCLE_COUNTER
+#if defined(__arm__)
+#define MEM_CYCLE_COUNTER()         (*(volatile uint32_t *)0xE0001004u)
+#elif defined(__x86_64__) || defined(__i386__)
+#define MEM_CYCLE_COUNTER()         ((uint32_t)__builtin_ia32_rdtsc())
+#else
+#define MEM_CYCLE_COUNTER()         ((uint32_t)0u)
+#endif
+#endif
+
+/**
+ * @def MEM_CONFIG_STATS
+ * @brief Set to 1 to record per-call statistics of the compare/copy/fill entry points (memory_stats.h).
+ **/
+#ifndef MEM_CONFIG_STATS
+#define MEM_CONFIG_STATS            (0)
+#endif
+
+/**
+ * @def MEM_CONFIG_TRACE
+ * @brief Set to 1 to capture every compare/copy/fill call into the trace ring (memory_trace.h).
+ **/
+#ifndef MEM_CONFIG_TRACE
+#define MEM_CONFIG_TRACE            (0)
+#endif
+
+/**
+ * @def MEM_CONFIG_WAIT_STATES
+ * @brief Wait states of every data access of the kernels, used by MEM_cycleBound (0 for zero-wait SRAM).
+ **/
+#ifndef MEM_CONFIG_WAIT_STATES
+#define MEM_CONFIG_WAIT_STATES      (0u)
+#endif
+
+/**
+ * @def MEM_ASSERT
+ * @brief Precondition check of the *Unchecked entry points; compiled out with NDEBUG.
+ **/
+#ifdef NDEBUG
+#define MEM_ASSERT(condition)       ((void)0)
+#else
+#define MEM_ASSERT(condition)       assert(condition)
+#endif
+
+#endif /* #ifndef MEMORY_CONFIG_H_ */
+/**@}*/
@@ -29,6 +29,8 @@
  *  @note       
  *              - Ensure that memory operations are performed within the allocated memory boundaries to prevent corruption.
  *              - This module is thread-safe and can be used in multi-threaded applications without additional synchronization.
+ *                Each call is reentrant, but copying a buffer that another context is writing can still tear;
+ *                hand such data over through memory_snapshot.h instead.
  *              - Always initialize the memory module before performing any operations.
  *
  *  @see        - memory_ops.h
@@ -43,6 +45,14 @@
 
 /* dependencies: */
 #include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 /* =================================
  *          PUBLIC DEFINES         *
@@ -104,6 +114,44 @@ typedef enum fillStruct
     FILL_BAD_ADDRESS        = -(EFAULT)      /**< NULL pointer */
 } MEM_struct_fill_t;
 
+/**
+ * @enum searchStruct
+ * @brief Enumeration to define the possible states of a byte or pattern search.
+ * @package memory_operations
+ *
+ * @typedef MEM_struct_search_t
+ **/
+typedef enum searchStruct
+{
+    PATTERN_FOUND           = (uint8_t)(0u), /**< Pattern found */
+    PATTERN_NOT_FOUND       = (uint8_t)(1u), /**< Pattern not present in the buffer */
+    SEARCH_ERROR            = -(ENOSYS),     /**< Empty pattern */
+    SEARCH_BAD_ADDRESS      = -(EFAULT)      /**< NULL pointer */
+} MEM_struct_search_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct memField
+ * @brief Location of one field inside a structure, as produced by MEM_FIELD.
+ * @package memory_operations
+ *
+ * @typedef MEM_field_t
+ **/
+typedef struct memField
+{
+    size_t offset;  /**< Byte offset of the field */
+    size_t size;    /**< Size of the field in bytes */
+} MEM_field_t;
+
+/**
+ * @def MEM_FIELD
+ * @brief Initializer for a MEM_field_t describing member of type.
+ **/
+#define MEM_FIELD(type, member) { offsetof(type, member), sizeof(((type *)0)->member) }
+
 /* =================================
  *    PUBLIC FUNCTION PROTOTYPES   *
  * ================================*/
@@ -116,6 +164,7 @@ typedef enum fillStruct
  *
  *  @details This function performs a byte-by-byte comparison of two structures to determine if they are identical.
  *           It checks each byte until a difference is found or until the entire structure has been compared.
+ *           The kernel (byte, word or burst loop) is selected by MEM_CONFIG_PROFILE.
  *
  *  @param   struct_a [in]  : Pointer to the first structure.
  *  @param   struct_b [in]  : Pointer to the second structure.
@@ -126,7 +175,7 @@ typedef enum fillStruct
  *              * STRUCTS_ARENT_EQUAL     : Structures are not equal.
  *              * COMPARE_BAD_ADDRESS     : Error due to a null pointer.
  **/
-MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct_b, size_t size);
+MEM_RAMFUNC MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct_b, size_t size);
 
 /**
  *  @fn      MEM_copyStruct
@@ -136,6 +185,7 @@ MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct
  *
  *  @details This function copies the contents of one structure to another byte by byte. It is useful for duplicating
  *           structures or transferring data from one memory location to another.
+ *           The kernel (byte loop, four- or eight-word bursts) is selected by MEM_CONFIG_PROFILE.
  *
  *  @param   source  [in]  : Pointer to the source structure.
  *  @param   destine [out] : Pointer to the destination structure.
@@ -146,7 +196,7 @@ MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct
  *              * STRUCT_NOT_COPIED     : Structure not copied correctly.
  *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
  **/
-MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size);
+MEM_RAMFUNC MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size);
 
 /**
  *  @fn      MEM_fillStruct
@@ -156,6 +206,7 @@ MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size)
  *
  *  @details This function fills a structure with a specified value byte by byte. It is useful for initializing
  *           structures or resetting memory to a known state.
+ *           The kernel (byte loop, word loop or eight-word bursts) is selected by MEM_CONFIG_PROFILE.
  *
  *  @param   struct_ptr [out] : Pointer to the structure to be filled.
  *  @param   size       [in]  : Size of the structure to be filled.
@@ -165,7 +216,492 @@ MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size)
  *              * STRUCT_FILLED        : Structure filled successfully.
  *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
  **/
-MEM_struct_fill_t MEM_fillStruct(void *struct_ptr, size_t size, uint8_t value);
+MEM_RAMFUNC MEM_struct_fill_t MEM_fillStruct(void *struct_ptr, size_t size, uint8_t value);
+
+/**
+ *  @fn      MEM_compareStructsUnchecked
+ *  @package memory_operations
+ *
+ *  @brief   MEM_compareStructs without argument validation, for callers that guarantee valid pointers.
+ *
+ *  @details Asserts on a null pointer unless NDEBUG is defined; never returns COMPARE_BAD_ADDRESS.
+ *
+ *  @param   struct_a [in]  : Pointer to the first structure.
+ *  @param   struct_b [in]  : Pointer to the second structure.
+ *  @param   size     [in]  : Size of the structures to be compared.
+ *
+ *  @return  MEM_struct_compare_t - STRUCTS_ARE_EQUAL or STRUCTS_ARENT_EQUAL.
+ **/
+MEM_RAMFUNC MEM_struct_compare_t MEM_compareStructsUnchecked(const void *struct_a, const void *struct_b, size_t size);
+
+/**
+ *  @fn      MEM_copyStructUnchecked
+ *  @package memory_operations
+ *
+ *  @brief   MEM_copyStruct without argument validation, for callers that guarantee valid pointers.
+ *
+ *  @details Asserts on a null pointer unless NDEBUG is defined; never returns COPY_BAD_ADDRESS.
+ *
+ *  @param   source  [in]  : Pointer to the source structure.
+ *  @param   destine [out] : Pointer to the destination structure.
+ *  @param   size    [in]  : Size of the structure to be copied.
+ *
+ *  @return  MEM_struct_copy_t - Always STRUCT_COPIED.
+ **/
+MEM_RAMFUNC MEM_struct_copy_t MEM_copyStructUnchecked(const void *source, void *destine, size_t size);
+
+/**
+ *  @fn      MEM_fillStructUnchecked
+ *  @package memory_operations
+ *
+ *  @brief   MEM_fillStruct without argument validation, for callers that guarantee a valid pointer.
+ *
+ *  @details Asserts on a null pointer unless NDEBUG is defined; never returns FILL_BAD_ADDRESS.
+ *
+ *  @param   struct_ptr [out] : Pointer to the structure to be filled.
+ *  @param   size       [in]  : Size of the structure to be filled.
+ *  @param   value      [in]  : Value to be used to fill the structure.
+ *
+ *  @return  MEM_struct_fill_t - Always STRUCT_FILLED.
+ **/
+MEM_RAMFUNC MEM_struct_fill_t MEM_fillStructUnchecked(void *struct_ptr, size_t size, uint8_t value);
+
+/**
+ *  @fn      MEM_ramfuncInit
+ *  @package memory_operations
+ *
+ *  @brief   Copies the .ramfunc section from its flash load address to RAM.
+ *
+ *  @details Call once from the reset handler, before any kernel runs, when MEM_CONFIG_RAMFUNC is 1 and the
+ *           section is linked with ld/memory_ramfunc.ld. Does nothing otherwise.
+ **/
+void MEM_ramfuncInit(void);
+
+/**
+ *  @fn      MEM_compareMasked
+ *  @package memory_operations
+ *
+ *  @brief   Compares two structures considering only the bits set in a mask - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Computes (a ^ b) & mask one word at a time and stops at the first non-zero result, so padding
+ *           and reserved bits are ignored in the same pass as the comparison. The word loop runs when all
+ *           three buffers are word aligned; otherwise, and for the trailing bytes, it works byte by byte.
+ *
+ *  @param   struct_a [in]  : Pointer to the first structure.
+ *  @param   struct_b [in]  : Pointer to the second structure.
+ *  @param   mask     [in]  : Pointer to the mask; set bits are significant.
+ *  @param   size     [in]  : Size of the structures and of the mask.
+ *
+ *  @return  MEM_struct_compare_t - Returns the comparison status, which can be:
+ *              * STRUCTS_ARE_EQUAL       : Structures are equal under the mask.
+ *              * STRUCTS_ARENT_EQUAL     : Structures differ in at least one significant bit.
+ *              * COMPARE_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+MEM_struct_compare_t MEM_compareMasked(const void *struct_a, const void *struct_b, const void *mask, size_t size);
+
+/**
+ *  @fn      MEM_buildMask
+ *  @package memory_operations
+ *
+ *  @brief   Builds a compare mask that selects the listed fields and clears everything else.
+ *
+ *  @details Typical use, once at startup:
+ *           static const MEM_field_t fields[] = { MEM_FIELD(frame_t, id), MEM_FIELD(frame_t, payload) };
+ *           MEM_buildMask(&frame_mask, sizeof(frame_mask), fields, 2u);
+ *
+ *  @param   mask   [out] : Pointer to the mask to build.
+ *  @param   size   [in]  : Size of the mask, equal to the size of the structure it describes.
+ *  @param   fields [in]  : Array of significant fields.
+ *  @param   count  [in]  : Number of entries in fields.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED        : Mask built.
+ *              * STRUCT_FILL_ERROR    : A field lies outside the mask.
+ *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+MEM_struct_fill_t MEM_buildMask(void *mask, size_t size, const MEM_field_t *fields, size_t count);
+
+/**
+ *  @fn      MEM_isFilled
+ *  @package memory_operations
+ *
+ *  @brief   Checks that every byte of a region holds a given value - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Intended for erase checks (0xFF) and zero checks. After a byte-wise head up to word alignment,
+ *           the region is scanned in four-word LDM bursts against the value replicated into a word. A
+ *           failing burst is rescanned byte by byte to locate the first deviating byte. With the Cortex-M4
+ *           DSP extension each burst is tested with USAD8/USADA8.
+ *
+ *  @param   struct_ptr [in]  : Pointer to the region to check.
+ *  @param   size       [in]  : Size of the region in bytes.
+ *  @param   value      [in]  : Expected value of every byte.
+ *  @param   first_bad  [out] : Offset of the first deviating byte, or size when the region is filled; may be NULL.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED        : Every byte holds value.
+ *              * STRUCT_NOT_FILLED    : At least one byte differs; see first_bad.
+ *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+MEM_struct_fill_t MEM_isFilled(const void *struct_ptr, size_t size, uint8_t value, size_t *first_bad);
+
+/**
+ *  @fn      MEM_copyVerified
+ *  @package memory_operations
+ *
+ *  @brief   Copies a structure and reads every burst back right after storing it - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details When source and destination share the same word offset, the bulk moves in four-word bursts:
+ *           LDM from the source, STM to the destination, then the burst is reloaded from the destination and
+ *           XOR-compared with the registers it was stored from. A failing burst is redone byte by byte to
+ *           locate the first byte that does not read back. Mutually misaligned blocks are verified per byte.
+ *
+ *  @param   source    [in]  : Pointer to the source structure.
+ *  @param   destine   [out] : Pointer to the destination structure.
+ *  @param   size      [in]  : Size of the structure to be copied.
+ *  @param   first_bad [out] : Offset of the first byte that did not read back, or size on success; may be NULL.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Structure copied and read back.
+ *              * STRUCT_NOT_COPIED     : A byte did not read back; see first_bad. Later bytes are not copied.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copyVerified(const void *source, void *destine, size_t size, size_t *first_bad);
+
+/**
+ *  @fn      MEM_fillVerified
+ *  @package memory_operations
+ *
+ *  @brief   Fills a structure and reads every burst back right after storing it - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Same loop as MEM_copyVerified with the value replicated into the burst registers, so the fill and
+ *           the check of MEM_isFilled run in a single pass over the region.
+ *
+ *  @param   struct_ptr [out] : Pointer to the structure to be filled.
+ *  @param   size       [in]  : Size of the structure to be filled.
+ *  @param   value      [in]  : Value to be used to fill the structure.
+ *  @param   first_bad  [out] : Offset of the first byte that did not read back, or size on success; may be NULL.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED        : Structure filled and read back.
+ *              * STRUCT_NOT_FILLED    : A byte did not read back; see first_bad. Later bytes are not filled.
+ *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+MEM_struct_fill_t MEM_fillVerified(void *struct_ptr, size_t size, uint8_t value, size_t *first_bad);
+
+/**
+ *  @fn      MEM_findByte
+ *  @package memory_operations
+ *
+ *  @brief   Finds the first occurrence of a byte value (memchr equivalent) - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Scans a word at a time: with x = word ^ (value replicated), the expression
+ *           (x - 0x01010101) & ~x & 0x80808080 is non-zero exactly when some byte of x is zero, i.e. when the
+ *           word contains value. Only the matching word is then examined byte by byte. With the Cortex-M4
+ *           DSP extension the zero test uses UADD8/SEL on the GE flags and scans two words per test.
+ *
+ *  @param   buffer [in]  : Pointer to the buffer to search.
+ *  @param   size   [in]  : Size of the buffer in bytes.
+ *  @param   value  [in]  : Byte value to look for.
+ *  @param   offset [out] : Offset of the first match; may be NULL.
+ *
+ *  @return  MEM_struct_search_t - Returns the search status, which can be:
+ *              * PATTERN_FOUND        : Value found at *offset.
+ *              * PATTERN_NOT_FOUND    : Value not present.
+ *              * SEARCH_BAD_ADDRESS   : Error due to a null pointer.
+ **/
+MEM_struct_search_t MEM_findByte(const void *buffer, size_t size, uint8_t value, size_t *offset);
+
+/**
+ *  @fn      MEM_findPattern
+ *  @package memory_operations
+ *
+ *  @brief   Finds the first occurrence of a byte sequence (memmem equivalent).
+ *
+ *  @details Candidates are produced by MEM_findByte on the first pattern byte and rejected early unless the
+ *           byte at the pattern's last position also matches; only then are the inner bytes compared.
+ *
+ *  @param   buffer       [in]  : Pointer to the buffer to search.
+ *  @param   size         [in]  : Size of the buffer in bytes.
+ *  @param   pattern      [in]  : Pointer to the pattern.
+ *  @param   pattern_size [in]  : Size of the pattern in bytes.
+ *  @param   offset       [out] : Offset of the first match; may be NULL.
+ *
+ *  @return  MEM_struct_search_t - Returns the search status, which can be:
+ *              * PATTERN_FOUND        : Pattern found at *offset.
+ *              * PATTERN_NOT_FOUND    : Pattern not present.
+ *              * SEARCH_ERROR         : Pattern is empty.
+ *              * SEARCH_BAD_ADDRESS   : Error due to a null pointer.
+ **/
+MEM_struct_search_t MEM_findPattern(const void *buffer, size_t size, const void *pattern, size_t pattern_size,
+                                    size_t *offset);
+
+/**
+ *  @fn      MEM_copySwap16
+ *  @package memory_operations
+ *
+ *  @brief   Copies an array of 16-bit values, swapping the byte order of each - ASSEMBLY: ARM (REV16).
+ *
+ *  @param   source  [in]  : Pointer to the source array.
+ *  @param   destine [out] : Pointer to the destination array; may equal source.
+ *  @param   size    [in]  : Size of the array in bytes, a multiple of 2.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Array copied and swapped.
+ *              * STRUCT_COPY_ERROR     : Size is not a multiple of the element size.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copySwap16(const void *source, void *destine, size_t size);
+
+/**
+ *  @fn      MEM_copySwap32
+ *  @package memory_operations
+ *
+ *  @brief   Copies an array of 32-bit values, swapping the byte order of each - ASSEMBLY: ARM (REV).
+ *
+ *  @param   source  [in]  : Pointer to the source array.
+ *  @param   destine [out] : Pointer to the destination array; may equal source.
+ *  @param   size    [in]  : Size of the array in bytes, a multiple of 4.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Array copied and swapped.
+ *              * STRUCT_COPY_ERROR     : Size is not a multiple of the element size.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copySwap32(const void *source, void *destine, size_t size);
+
+/**
+ *  @fn      MEM_copySwap64
+ *  @package memory_operations
+ *
+ *  @brief   Copies an array of 64-bit values, swapping the byte order of each - ASSEMBLY: ARM (REV).
+ *
+ *  @param   source  [in]  : Pointer to the source array.
+ *  @param   destine [out] : Pointer to the destination array; may equal source.
+ *  @param   size    [in]  : Size of the array in bytes, a multiple of 8.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Array copied and swapped.
+ *              * STRUCT_COPY_ERROR     : Size is not a multiple of the element size.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copySwap64(const void *source, void *destine, size_t size);
+
+/**
+ *  @fn      MEM_copySwapFields
+ *  @package memory_operations
+ *
+ *  @brief   Copies a structure in one pass, byte-swapping only its multi-byte fields.
+ *
+ *  @details Walks the field list in order: the bytes between fields are burst-copied unchanged and each field
+ *           goes through the swap kernel matching its size (2, 4 or 8). Fields of any other size are copied
+ *           unchanged. Fields must be sorted by offset and must not overlap.
+ *
+ *  @param   source  [in]  : Pointer to the source structure.
+ *  @param   destine [out] : Pointer to the destination structure; may equal source.
+ *  @param   size    [in]  : Size of the structure in bytes.
+ *  @param   fields  [in]  : Fields to swap, sorted by offset (see MEM_FIELD).
+ *  @param   count   [in]  : Number of entries in fields.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Structure copied and fields swapped.
+ *              * STRUCT_COPY_ERROR     : Fields unsorted, overlapping or outside the structure.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copySwapFields(const void *source, void *destine, size_t size,
+                                     const MEM_field_t *fields, size_t count);
+
+/**
+ *  @fn      MEM_copy2D
+ *  @package memory_operations
+ *
+ *  @brief   Copies a rectangle of rows bytes-wide rows between two buffers with independent strides.
+ *
+ *  @details Meant for framebuffer blits, image tiles and sample matrices. When both strides equal the width
+ *           the rectangle is one contiguous block and is copied in a single transfer.
+ *
+ *  @param   source         [in]  : Pointer to the first byte of the source rectangle.
+ *  @param   source_stride  [in]  : Bytes from the start of one source row to the next.
+ *  @param   destine        [out] : Pointer to the first byte of the destination rectangle.
+ *  @param   destine_stride [in]  : Bytes from the start of one destination row to the next.
+ *  @param   width          [in]  : Bytes per row.
+ *  @param   rows           [in]  : Number of rows.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Rectangle copied (also for an empty rectangle).
+ *              * STRUCT_COPY_ERROR     : A stride is smaller than the width, so rows would overlap.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copy2D(const void *source, size_t source_stride, void *destine, size_t destine_stride,
+                             size_t width, size_t rows);
+
+/**
+ *  @fn      MEM_fill2D
+ *  @package memory_operations
+ *
+ *  @brief   Fills a rectangle of rows bytes-wide rows with a value.
+ *
+ *  @details When the stride equals the width the rectangle is one contiguous block and is filled in a single
+ *           transfer.
+ *
+ *  @param   struct_ptr [out] : Pointer to the first byte of the rectangle.
+ *  @param   stride     [in]  : Bytes from the start of one row to the next.
+ *  @param   width      [in]  : Bytes per row.
+ *  @param   rows       [in]  : Number of rows.
+ *  @param   value      [in]  : Value to be used to fill the rectangle.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED         : Rectangle filled (also for an empty rectangle).
+ *              * STRUCT_FILL_ERROR     : The stride is smaller than the width, so rows would overlap.
+ *              * FILL_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_fill_t MEM_fill2D(void *struct_ptr, size_t stride, size_t width, size_t rows, uint8_t value);
+
+/**
+ *  @fn      MEM_gatherField
+ *  @package memory_operations
+ *
+ *  @brief   Packs one field of every structure of an array into a contiguous column - ASSEMBLY: ARM.
+ *
+ *  @details Turns an array of structures into one column of a structure of arrays, e.g. the temperature of
+ *           every sensor record. 8, 16 and 32-bit fields are merged into whole-word stores on ARM when the
+ *           column is word aligned and the field is aligned to its size.
+ *
+ *  @param   source       [in]  : Pointer to the first structure of the array.
+ *  @param   destine      [out] : Pointer to the column, count * field_size bytes; must not overlap source.
+ *  @param   count        [in]  : Number of structures.
+ *  @param   stride       [in]  : Bytes from one structure to the next, usually sizeof the structure.
+ *  @param   field_offset [in]  : Offset of the field inside a structure (see offsetof).
+ *  @param   field_size   [in]  : Size of the field in bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Column written (also for count 0).
+ *              * STRUCT_COPY_ERROR     : Empty field, or field not inside the stride.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_gatherField(const void *source, void *destine, size_t count, size_t stride,
+                                  size_t field_offset, size_t field_size);
+
+/**
+ *  @fn      MEM_scatterField
+ *  @package memory_operations
+ *
+ *  @brief   Writes a contiguous column into one field of every structure of an array - ASSEMBLY: ARM.
+ *
+ *  @details The inverse of MEM_gatherField. The other bytes of the structures are left untouched.
+ *
+ *  @param   source       [in]  : Pointer to the column, count * field_size bytes.
+ *  @param   destine      [out] : Pointer to the first structure of the array; must not overlap source.
+ *  @param   count        [in]  : Number of structures.
+ *  @param   stride       [in]  : Bytes from one structure to the next, usually sizeof the structure.
+ *  @param   field_offset [in]  : Offset of the field inside a structure (see offsetof).
+ *  @param   field_size   [in]  : Size of the field in bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Fields written (also for count 0).
+ *              * STRUCT_COPY_ERROR     : Empty field, or field not inside the stride.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_scatterField(const void *source, void *destine, size_t count, size_t stride,
+                                   size_t field_offset, size_t field_size);
+
+/**
+ *  @fn      MEM_deinterleave
+ *  @package memory_operations
+ *
+ *  @brief   Splits interleaved multi-channel samples into one plane per channel - ASSEMBLY: ARM (PKHBT).
+ *
+ *  @details Meant for multi-channel ADC and audio buffers. Stereo 16-bit samples use PKHBT/PKHTB on a
+ *           Cortex-M4 with the DSP extension; stereo samples of any supported size use PSHUFB on x86 with
+ *           SSSE3.
+ *
+ *  @param   source      [in]  : Pointer to the interleaved frames, frames * channels * sample_size bytes.
+ *  @param   destine     [out] : Pointer to the planes; channel c starts at c * frames * sample_size. Must not
+ *                               overlap source.
+ *  @param   frames      [in]  : Number of frames (samples per channel).
+ *  @param   channels    [in]  : Number of channels per frame.
+ *  @param   sample_size [in]  : Size of one sample: 1, 2 or 4 bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Planes written (also for frames 0).
+ *              * STRUCT_COPY_ERROR     : No channel, unsupported sample size, or total size overflows.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_deinterleave(const void *source, void *destine, size_t frames, size_t channels,
+                                   size_t sample_size);
+
+/**
+ *  @fn      MEM_interleave
+ *  @package memory_operations
+ *
+ *  @brief   Merges one plane per channel into interleaved multi-channel samples - ASSEMBLY: ARM (PKHBT).
+ *
+ *  @details The inverse of MEM_deinterleave, e.g. to build a DAC or I2S frame buffer. Stereo samples use
+ *           PUNPCKL on x86 with SSE2.
+ *
+ *  @param   source      [in]  : Pointer to the planes; channel c starts at c * frames * sample_size.
+ *  @param   destine     [out] : Pointer to the interleaved frames, frames * channels * sample_size bytes. Must
+ *                               not overlap source.
+ *  @param   frames      [in]  : Number of frames (samples per channel).
+ *  @param   channels    [in]  : Number of channels per frame.
+ *  @param   sample_size [in]  : Size of one sample: 1, 2 or 4 bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Frames written (also for frames 0).
+ *              * STRUCT_COPY_ERROR     : No channel, unsupported sample size, or total size overflows.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_interleave(const void *source, void *destine, size_t frames, size_t channels,
+                                 size_t sample_size);
+
+/**
+ *  @fn      MEM_copyFromRing
+ *  @package memory_operations
+ *
+ *  @brief   Copies size bytes out of a circular buffer, wrapping at its end.
+ *
+ *  @details Replaces the two MEM_copyStruct calls and the boundary arithmetic of a wrapping read. The offset
+ *           may be a free-running counter: it is reduced with a mask when ring_size is a power of two, and
+ *           with a division only when it is past the end of the ring otherwise.
+ *
+ *  @param   ring_base [in]  : Pointer to the first byte of the ring storage.
+ *  @param   ring_size [in]  : Size of the ring storage in bytes.
+ *  @param   offset    [in]  : Position of the first byte to read; may be a free-running counter.
+ *  @param   destine   [out] : Pointer to the linear destination buffer.
+ *  @param   size      [in]  : Bytes to copy, at most ring_size.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Bytes copied (also for size 0).
+ *              * STRUCT_COPY_ERROR     : Empty ring, or size larger than the ring.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copyFromRing(const void *ring_base, size_t ring_size, size_t offset, void *destine,
+                                   size_t size);
+
+/**
+ *  @fn      MEM_copyToRing
+ *  @package memory_operations
+ *
+ *  @brief   Copies size bytes into a circular buffer, wrapping at its end.
+ *
+ *  @details The mirror of MEM_copyFromRing, with the same offset reduction.
+ *
+ *  @param   source    [in]  : Pointer to the linear source buffer.
+ *  @param   ring_base [out] : Pointer to the first byte of the ring storage.
+ *  @param   ring_size [in]  : Size of the ring storage in bytes.
+ *  @param   offset    [in]  : Position of the first byte to write; may be a free-running counter.
+ *  @param   size      [in]  : Bytes to copy, at most ring_size.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Bytes copied (also for size 0).
+ *              * STRUCT_COPY_ERROR     : Empty ring, or size larger than the ring.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_struct_copy_t MEM_copyToRing(const void *source, void *ring_base, size_t ring_size, size_t offset,
+                                 size_t size);
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* #ifndef MEMORY_OPS_H_ */
 /**@}*/
@@ -0,0 +1,301 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_operations
+ *  @{
+ *
+ *  @package    memory_operations
+ *  @brief      Header-only C++20 layer over the MEM_* kernels: typed, size-checked and constexpr-capable.
+ *
+ *  @file       memory_ops.hpp
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The size of every operation comes from the type, never from the caller. Objects of 1, 2, 4 or 8
+ *              bytes are moved as a single scalar load/store chosen at compile time; anything larger goes to
+ *              MEM_copyStruct, MEM_compareStructs or MEM_fillStruct. In constant-evaluated contexts the
+ *              functions use plain assignment and std::bit_cast instead, so generic code can call them from
+ *              constexpr functions at no runtime cost.
+ *
+ *              Key functionalities include:
+ *              - **mem::copy**: Copies an object or a span of objects.
+ *              - **mem::equal**: Compares objects or spans byte-wise.
+ *              - **mem::fill**: Fills an object or a span with a byte value.
+ *
+ *  @note
+ *              - Only trivially copyable types are accepted; this is checked with static_assert.
+ *              - mem::equal compares object representations, padding bytes included, like MEM_compareStructs.
+ *                Use MEM_compareMasked for types with padding.
+ *              - Padding bytes have no value during constant evaluation, so a constexpr mem::equal on a type
+ *                with padding is rejected by the compiler.
+ *
+ *  @see        - memory_ops.h
+ **/
+
+#ifndef MEMORY_OPS_HPP_
+#define MEMORY_OPS_HPP_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#include "memory_ops.h"
+
+namespace mem
+{
+
+/* =================================
+ *        PRIVATE KERNELS          *
+ * ================================*/
+
+namespace detail
+{
+
+/**
+ * @brief Unsigned scalar of exactly N bytes, or void when there is none.
+ **/
+template <std::size_t N>
+using scalar_t = std::conditional_t<N == 1u, std::uint8_t,
+                 std::conditional_t<N == 2u, std::uint16_t,
+                 std::conditional_t<N == 4u, std::uint32_t,
+                 std::conditional_t<N == 8u, std::uint64_t, void>>>>;
+
+/**
+ * @brief True when objects of N bytes are moved as a single scalar.
+ **/
+template <std::size_t N>
+inline constexpr bool is_scalar_size_v = !std::is_void_v<scalar_t<N>>;
+
+/**
+ * @brief True for std::span specializations, which must reach the span overloads and not the object ones.
+ **/
+template <typename T>
+inline constexpr bool is_span_v = false;
+
+template <typename T, std::size_t Extent>
+inline constexpr bool is_span_v<std::span<T, Extent>> = true;
+
+template <typename T>
+inline constexpr void check_type() noexcept
+{
+    static_assert(std::is_trivially_copyable_v<T>, "mem:: operations require a trivially copyable type");
+}
+
+template <std::size_t N>
+inline void copy_bytes(void *destine, const void *source) noexcept
+{
+    if constexpr (is_scalar_size_v<N>)
+    {
+        scalar_t<N> word;
+
+        __builtin_memcpy(&word, source, N);
+        __builtin_memcpy(destine, &word, N);
+    }
+    else
+    {
+        (void)MEM_copyStruct(source, destine, N);
+    }
+}
+
+template <std::size_t N>
+inline bool equal_bytes(const void *struct_a, const void *struct_b) noexcept
+{
+    if constexpr (is_scalar_size_v<N>)
+    {
+        scalar_t<N> word_a;
+        scalar_t<N> word_b;
+
+        __builtin_memcpy(&word_a, struct_a, N);
+        __builtin_memcpy(&word_b, struct_b, N);
+
+        return word_a == word_b;
+    }
+    else
+    {
+        return MEM_compareStructs(struct_a, struct_b, N) == STRUCTS_ARE_EQUAL;
+    }
+}
+
+template <std::size_t N>
+inline void fill_bytes(void *destine, std::uint8_t value) noexcept
+{
+    if constexpr (is_scalar_size_v<N>)
+    {
+        const scalar_t<N> ones = static_cast<scalar_t<N>>(static_cast<scalar_t<N>>(~scalar_t<N>{0u}) / 0xFFu);
+        const scalar_t<N> word = static_cast<scalar_t<N>>(ones * value);
+
+        __builtin_memcpy(destine, &word, N);
+    }
+    else
+    {
+        (void)MEM_fillStruct(destine, N, value);
+    }
+}
+
+} /* namespace detail */
+
+/* =================================
+ *        PUBLIC FUNCTIONS         *
+ * ================================*/
+
+/**
+ *  @fn      mem::copy
+ *  @brief   Copies src into dst; the size is sizeof(T).
+ **/
+template <typename T>
+    requires (!detail::is_span_v<T>)
+constexpr void copy(T &dst, const T &src) noexcept
+{
+    detail::check_type<T>();
+
+    if (std::is_constant_evaluated())
+    {
+        dst = src;
+    }
+    else
+    {
+        detail::copy_bytes<sizeof(T)>(&dst, &src);
+    }
+}
+
+/**
+ *  @fn      mem::equal
+ *  @brief   Returns true when a and b have identical object representations.
+ **/
+template <typename T>
+    requires (!detail::is_span_v<T>)
+constexpr bool equal(const T &a, const T &b) noexcept
+{
+    detail::check_type<T>();
+
+    if (std::is_constant_evaluated())
+    {
+        return std::bit_cast<std::array<unsigned char, sizeof(T)>>(a)
+               == std::bit_cast<std::array<unsigned char, sizeof(T)>>(b);
+    }
+
+    return detail::equal_bytes<sizeof(T)>(&a, &b);
+}
+
+/**
+ *  @fn      mem::fill
+ *  @brief   Sets every byte of dst to value.
+ **/
+template <typename T>
+    requires (!detail::is_span_v<T>)
+constexpr void fill(T &dst, std::uint8_t value) noexcept
+{
+    detail::check_type<T>();
+
+    if (std::is_constant_evaluated())
+    {
+        std::array<unsigned char, sizeof(T)> bytes{};
+
+        for (unsigned char &byte : bytes)
+        {
+            byte = value;
+        }
+
+        dst = std::bit_cast<T>(bytes);
+    }
+    else
+    {
+        detail::fill_bytes<sizeof(T)>(&dst, value);
+    }
+}
+
+/**
+ *  @fn      mem::copy (span)
+ *  @brief   Copies every element of src into the front of dst.
+ *  @return  false, copying nothing, when dst is shorter than src.
+ **/
+template <typename T, std::size_t Extent>
+constexpr bool copy(std::span<T, Extent> dst, std::span<const std::type_identity_t<T>> src) noexcept
+{
+    detail::check_type<T>();
+
+    if (dst.size() < src.size())
+    {
+        return false;
+    }
+
+    if (std::is_constant_evaluated())
+    {
+        for (std::size_t index = 0u; index < src.size(); ++index)
+        {
+            dst[index] = src[index];
+        }
+    }
+    else if (!src.empty())
+    {
+        (void)MEM_copyStruct(src.data(), dst.data(), src.size_bytes());
+    }
+
+    return true;
+}
+
+/**
+ *  @fn      mem::equal (span)
+ *  @brief   Returns true when both spans have the same length and identical object representations.
+ **/
+template <typename T, std::size_t Extent>
+constexpr bool equal(std::span<T, Extent> a, std::span<const std::remove_cv_t<T>> b) noexcept
+{
+    detail::check_type<std::remove_cv_t<T>>();
+
+    if (a.size() != b.size())
+    {
+        return false;
+    }
+
+    if (std::is_constant_evaluated())
+    {
+        for (std::size_t index = 0u; index < a.size(); ++index)
+        {
+            if (!mem::equal(a[index], b[index]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    return a.empty() || (MEM_compareStructs(a.data(), b.data(), a.size_bytes()) == STRUCTS_ARE_EQUAL);
+}
+
+/**
+ *  @fn      mem::fill (span)
+ *  @brief   Sets every byte of every element of dst to value.
+ **/
+template <typename T, std::size_t Extent>
+constexpr void fill(std::span<T, Extent> dst, std::uint8_t value) noexcept
+{
+    detail::check_type<T>();
+
+    if (std::is_constant_evaluated())
+    {
+        for (T &element : dst)
+        {
+            mem::fill(element, value);
+        }
+    }
+    else if (!dst.empty())
+    {
+        (void)MEM_fillStruct(dst.data(), dst.size_bytes(), value);
+    }
+}
+
+} /* namespace mem */
+
+#endif /* #ifndef MEMORY_OPS_HPP_ */
+/**@}*/
@@ -0,0 +1,198 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_ring
+ *  @{
+ *
+ *  @package    memory_ring
+ *  @brief      Lock-free single-producer/single-consumer queue of fixed-size records.
+ *
+ *  @file       memory_ring.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The ring stores whole records in caller-owned storage of capacity * record_size bytes. The
+ *              capacity is a power of two, so slot indexing is a mask. Head and tail are free-running 32-bit
+ *              counters owned by the producer and the consumer respectively; each side only reads the other's
+ *              counter with acquire ordering and publishes its own with release ordering (DMB on the M4,
+ *              __atomic builtins on the host).
+ *
+ *              Key functionalities include:
+ *              - **MEM_ringInit**: Binds storage to a ring.
+ *              - **MEM_ringPush** / **MEM_ringPop**: Moves one record with a single burst copy.
+ *              - **MEM_ringPushBatch** / **MEM_ringPopBatch**: Moves up to N records with at most two burst copies.
+ *              - **MEM_ringCount**: Number of records currently queued.
+ *
+ *  @note
+ *              - Exactly one producer and one consumer context per ring (e.g. an ISR and a task).
+ *              - Word-aligned storage and a record size that is a multiple of four keep every copy on the
+ *                LDM/STM burst path.
+ *
+ *  @see        - memory_ring.h
+ **/
+
+#ifndef MEMORY_RING_H_
+#define MEMORY_RING_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *      PUBLIC STATUS ENUMS     *
+ * ================================*/
+
+/**
+ * @enum ringStatus
+ * @brief Enumeration to define the possible states of a ring operation.
+ * @package memory_ring
+ *
+ * @typedef MEM_ring_status_t
+ **/
+typedef enum ringStatus
+{
+    RING_OK                 = (uint8_t)(0u), /**< Operation completed successfully */
+    RING_FULL               = (uint8_t)(1u), /**< Not every record fitted */
+    RING_EMPTY              = (uint8_t)(2u), /**< Fewer records queued than requested */
+    RING_BAD_SIZE           = -(EINVAL),     /**< Zero record size or capacity not a power of two */
+    RING_BAD_ADDRESS        = -(EFAULT)      /**< NULL pointer */
+} MEM_ring_status_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct memRing
+ * @brief SPSC ring state. The queued count is head - tail.
+ * @package memory_ring
+ *
+ * @typedef MEM_ring_t
+ **/
+typedef struct memRing
+{
+    volatile uint32_t head;         /**< Records ever pushed; written by the producer only */
+    volatile uint32_t tail;         /**< Records ever popped; written by the consumer only */
+    uint32_t          mask;         /**< Capacity - 1 */
+    size_t            record_size;  /**< Size of one record in bytes */
+    uint8_t          *buffer;       /**< Caller-owned storage, capacity * record_size bytes */
+} MEM_ring_t;
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_ringInit
+ *  @package memory_ring
+ *
+ *  @brief   Binds caller-owned storage to an empty ring.
+ *
+ *  @param   ring        [out] : Pointer to the ring.
+ *  @param   storage     [in]  : Storage of capacity * record_size bytes.
+ *  @param   record_size [in]  : Size of one record in bytes.
+ *  @param   capacity    [in]  : Number of records; a power of two no larger than 2^31.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : Ring initialized.
+ *              * RING_BAD_SIZE         : Zero record size, or capacity is not a power of two.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_ring_status_t MEM_ringInit(MEM_ring_t *ring, void *storage, size_t record_size, uint32_t capacity);
+
+/**
+ *  @fn      MEM_ringPush
+ *  @package memory_ring
+ *
+ *  @brief   Appends one record. Producer side only.
+ *
+ *  @param   ring   [in,out] : Pointer to the ring.
+ *  @param   record [in]     : Record of ring->record_size bytes.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : Record queued.
+ *              * RING_FULL             : Ring is full; nothing was queued.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_ring_status_t MEM_ringPush(MEM_ring_t *ring, const void *record);
+
+/**
+ *  @fn      MEM_ringPop
+ *  @package memory_ring
+ *
+ *  @brief   Removes the oldest record. Consumer side only.
+ *
+ *  @param   ring   [in,out] : Pointer to the ring.
+ *  @param   record [out]    : Destination of ring->record_size bytes.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : Record dequeued.
+ *              * RING_EMPTY            : Ring is empty; nothing was dequeued.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_ring_status_t MEM_ringPop(MEM_ring_t *ring, void *record);
+
+/**
+ *  @fn      MEM_ringPushBatch
+ *  @package memory_ring
+ *
+ *  @brief   Appends as many of count contiguous records as fit, with at most two burst copies.
+ *
+ *  @param   ring    [in,out] : Pointer to the ring.
+ *  @param   records [in]     : Array of count records.
+ *  @param   count   [in]     : Number of records offered.
+ *  @param   pushed  [out]    : Number of records actually queued; may be NULL.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : All records queued.
+ *              * RING_FULL             : Only *pushed records fitted.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_ring_status_t MEM_ringPushBatch(MEM_ring_t *ring, const void *records, size_t count, size_t *pushed);
+
+/**
+ *  @fn      MEM_ringPopBatch
+ *  @package memory_ring
+ *
+ *  @brief   Removes up to count of the oldest records, with at most two burst copies.
+ *
+ *  @param   ring    [in,out] : Pointer to the ring.
+ *  @param   records [out]    : Destination array with room for count records.
+ *  @param   count   [in]     : Number of records requested.
+ *  @param   popped  [out]    : Number of records actually dequeued; may be NULL.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : All requested records dequeued.
+ *              * RING_EMPTY            : Only *popped records were queued.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_ring_status_t MEM_ringPopBatch(MEM_ring_t *ring, void *records, size_t count, size_t *popped);
+
+/**
+ *  @fn      MEM_ringCount
+ *  @package memory_ring
+ *
+ *  @brief   Returns the number of queued records. Exact for the owner of either side, a snapshot otherwise.
+ *
+ *  @param   ring [in] : Pointer to the ring.
+ *
+ *  @return  uint32_t - Queued records, or zero for a null pointer.
+ **/
+uint32_t MEM_ringCount(const MEM_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_RING_H_ */
+/**@}*/
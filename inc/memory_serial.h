@@ -0,0 +1,205 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_serial
+ *  @{
+ *
+ *  @package    memory_serial
+ *  @brief      Descriptor-driven packing of C structures into packed wire formats and back.
+ *
+ *  @file       memory_serial.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              A wire format is described once as a table of fields (structure offset, size, wire offset and
+ *              wire byte order). MEM_serialCompile turns the table into a list of copy operations, merging
+ *              fields that are adjacent both in the structure and on the wire into a single burst copy, and
+ *              runs of equally sized fields that need the same byte swap into a single swap copy. Packing and
+ *              unpacking then replay the list in one pass; padding never reaches the wire.
+ *
+ *              Key functionalities include:
+ *              - **MEM_serialCompile**: Compiles a field table into merged copy operations.
+ *              - **MEM_serialPack**: Structure to wire.
+ *              - **MEM_serialUnpack**: Wire to structure.
+ *
+ *  @note
+ *              - Wire bytes not covered by any field are left untouched by MEM_serialPack.
+ *              - Only consecutive table entries are merged: list fields in wire order to get the most merging.
+ *
+ *  @see        - memory_ops.h
+ **/
+
+#ifndef MEMORY_SERIAL_H_
+#define MEMORY_SERIAL_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *          PUBLIC DEFINES         *
+ * ================================*/
+
+/**
+ * @def MEM_SERIAL_FIELD
+ * @brief Initializer for a MEM_serial_field_t describing member of type at wire_offset in byte order endian.
+ **/
+#define MEM_SERIAL_FIELD(type, member, wire_offset, endian)                             \
+    { (uint16_t)offsetof(type, member), (uint16_t)sizeof(((type *)0)->member),         \
+      (uint16_t)(wire_offset), (uint8_t)(endian) }
+
+/* =================================
+ *      PUBLIC STATUS ENUMS     *
+ * ================================*/
+
+/**
+ * @enum serialStatus
+ * @brief Enumeration to define the possible states of a serializer operation.
+ * @package memory_serial
+ *
+ * @typedef MEM_serial_status_t
+ **/
+typedef enum serialStatus
+{
+    SERIAL_OK               = (uint8_t)(0u), /**< Operation completed successfully */
+    SERIAL_NO_SPACE         = (uint8_t)(1u), /**< Operation storage too small for the field table */
+    SERIAL_BAD_FIELD        = -(EINVAL),     /**< Zero-sized field or unknown byte order */
+    SERIAL_BAD_ADDRESS      = -(EFAULT)      /**< NULL pointer */
+} MEM_serial_status_t;
+
+/**
+ * @enum serialEndian
+ * @brief Byte order of a field on the wire.
+ * @package memory_serial
+ *
+ * @typedef MEM_serial_endian_t
+ **/
+typedef enum serialEndian
+{
+    SERIAL_NATIVE           = (uint8_t)(0u), /**< Same as the CPU, copied unchanged */
+    SERIAL_LITTLE           = (uint8_t)(1u), /**< Little-endian on the wire */
+    SERIAL_BIG              = (uint8_t)(2u)  /**< Big-endian (network order) on the wire */
+} MEM_serial_endian_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct memSerialField
+ * @brief One field of a wire format. Fields of size 2, 4 or 8 are byte-swapped when the wire order differs
+ *        from the CPU's; any other size (bytes, arrays of bytes) is copied unchanged.
+ * @package memory_serial
+ *
+ * @typedef MEM_serial_field_t
+ **/
+typedef struct memSerialField
+{
+    uint16_t offset;        /**< Offset in the structure */
+    uint16_t size;          /**< Size in bytes */
+    uint16_t wire_offset;   /**< Offset on the wire */
+    uint8_t  endian;        /**< MEM_serial_endian_t of the wire representation */
+} MEM_serial_field_t;
+
+/**
+ * @struct memSerialOp
+ * @brief One compiled copy operation, covering one or more merged fields.
+ * @package memory_serial
+ *
+ * @typedef MEM_serial_op_t
+ **/
+typedef struct memSerialOp
+{
+    uint16_t offset;        /**< Offset in the structure */
+    uint16_t size;          /**< Bytes covered */
+    uint16_t wire_offset;   /**< Offset on the wire */
+    uint8_t  swap;          /**< Swap width in bytes (2, 4, 8), or 0 for a plain copy */
+} MEM_serial_op_t;
+
+/**
+ * @struct memSerial
+ * @brief Compiled wire format.
+ * @package memory_serial
+ *
+ * @typedef MEM_serial_t
+ **/
+typedef struct memSerial
+{
+    MEM_serial_op_t *ops;       /**< Caller-owned operation storage */
+    size_t           count;     /**< Number of compiled operations */
+    size_t           wire_size; /**< Bytes spanned on the wire */
+} MEM_serial_t;
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_serialCompile
+ *  @package memory_serial
+ *
+ *  @brief   Compiles a field table into merged copy operations.
+ *
+ *  @param   serial   [out] : Pointer to the compiled format.
+ *  @param   fields   [in]  : Field table.
+ *  @param   count    [in]  : Number of entries in fields.
+ *  @param   ops      [out] : Operation storage; count entries always suffice.
+ *  @param   capacity [in]  : Number of entries in ops.
+ *
+ *  @return  MEM_serial_status_t - Returns the operation status, which can be:
+ *              * SERIAL_OK             : Format compiled.
+ *              * SERIAL_NO_SPACE       : ops cannot hold the merged operations.
+ *              * SERIAL_BAD_FIELD      : Zero-sized field or unknown byte order.
+ *              * SERIAL_BAD_ADDRESS    : Error due to a null pointer.
+ **/
+MEM_serial_status_t MEM_serialCompile(MEM_serial_t *serial, const MEM_serial_field_t *fields, size_t count,
+                                      MEM_serial_op_t *ops, size_t capacity);
+
+/**
+ *  @fn      MEM_serialPack
+ *  @package memory_serial
+ *
+ *  @brief   Writes a structure to its wire representation.
+ *
+ *  @param   serial [in]  : Pointer to the compiled format.
+ *  @param   source [in]  : Pointer to the structure.
+ *  @param   wire   [out] : Pointer to at least serial->wire_size bytes.
+ *
+ *  @return  MEM_serial_status_t - Returns the operation status, which can be:
+ *              * SERIAL_OK             : Structure packed.
+ *              * SERIAL_BAD_ADDRESS    : Error due to a null pointer.
+ **/
+MEM_serial_status_t MEM_serialPack(const MEM_serial_t *serial, const void *source, void *wire);
+
+/**
+ *  @fn      MEM_serialUnpack
+ *  @package memory_serial
+ *
+ *  @brief   Reads a structure back from its wire representation. Padding in the structure is left untouched.
+ *
+ *  @param   serial  [in]  : Pointer to the compiled format.
+ *  @param   wire    [in]  : Pointer to at least serial->wire_size bytes.
+ *  @param   destine [out] : Pointer to the structure.
+ *
+ *  @return  MEM_serial_status_t - Returns the operation status, which can be:
+ *              * SERIAL_OK             : Structure unpacked.
+ *              * SERIAL_BAD_ADDRESS    : Error due to a null pointer.
+ **/
+MEM_serial_status_t MEM_serialUnpack(const MEM_serial_t *serial, const void *wire, void *destine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_SERIAL_H_ */
+/**@}*/
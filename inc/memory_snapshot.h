@@ -0,0 +1,161 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_snapshot
+ *  @{
+ *
+ *  @package    memory_snapshot
+ *  @brief      Sequence-locked snapshot publisher for handing structures from an ISR to a task without masking
+ *              interrupts.
+ *
+ *  @file       memory_snapshot.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              A snapshot pairs caller-owned storage with a sequence counter. The writer makes the counter odd,
+ *              burst-copies the new value in and makes the counter even again. A reader copies the storage out
+ *              and accepts the copy only if the counter was even and unchanged across the copy; otherwise it
+ *              retries. Neither side ever disables interrupts and the writer never waits.
+ *
+ *              Key functionalities include:
+ *              - **MEM_snapshotInit**: Binds storage to a snapshot.
+ *              - **MEM_snapshotPublish**: Publishes a new value (writer side).
+ *              - **MEM_snapshotRead**: Reads a consistent value, retrying on a concurrent publish.
+ *              - **MEM_snapshotTryRead**: Single read attempt that reports a torn copy instead of retrying.
+ *
+ *  @note
+ *              - Exactly one writer per snapshot. Any number of readers.
+ *              - MEM_snapshotRead spins until the writer finishes, so it must not run in a context that
+ *                preempts the writer (e.g. reading from an ISR that interrupts the publishing task). Use
+ *                MEM_snapshotTryRead there.
+ *
+ *  @see        - memory_snapshot.h
+ **/
+
+#ifndef MEMORY_SNAPSHOT_H_
+#define MEMORY_SNAPSHOT_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *      PUBLIC STATUS ENUMS     *
+ * ================================*/
+
+/**
+ * @enum snapshotStatus
+ * @brief Enumeration to define the possible states of a snapshot operation.
+ * @package memory_snapshot
+ *
+ * @typedef MEM_snapshot_status_t
+ **/
+typedef enum snapshotStatus
+{
+    SNAPSHOT_OK             = (uint8_t)(0u), /**< Operation completed successfully */
+    SNAPSHOT_TORN           = (uint8_t)(1u), /**< A publish overlapped the read; the copy is not valid */
+    SNAPSHOT_BAD_SIZE       = -(EINVAL),     /**< Zero-sized storage */
+    SNAPSHOT_BAD_ADDRESS    = -(EFAULT)      /**< NULL pointer */
+} MEM_snapshot_status_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct memSnapshot
+ * @brief Storage bound to its sequence counter. Even sequence: stable; odd: publish in progress.
+ * @package memory_snapshot
+ *
+ * @typedef MEM_snapshot_t
+ **/
+typedef struct memSnapshot
+{
+    volatile uint32_t sequence;     /**< Publish counter */
+    size_t            size;         /**< Size of the storage in bytes */
+    void             *data;         /**< Caller-owned storage */
+} MEM_snapshot_t;
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_snapshotInit
+ *  @package memory_snapshot
+ *
+ *  @brief   Binds caller-owned storage to a snapshot and resets its sequence counter.
+ *
+ *  @param   snapshot [out] : Pointer to the snapshot.
+ *  @param   storage  [in]  : Storage holding the published structure; word alignment enables burst copies.
+ *  @param   size     [in]  : Size of the storage in bytes.
+ *
+ *  @return  MEM_snapshot_status_t - Returns the operation status, which can be:
+ *              * SNAPSHOT_OK           : Snapshot initialized.
+ *              * SNAPSHOT_BAD_SIZE     : Size is zero.
+ *              * SNAPSHOT_BAD_ADDRESS  : Error due to a null pointer.
+ **/
+MEM_snapshot_status_t MEM_snapshotInit(MEM_snapshot_t *snapshot, void *storage, size_t size);
+
+/**
+ *  @fn      MEM_snapshotPublish
+ *  @package memory_snapshot
+ *
+ *  @brief   Publishes a new value. Wait-free; call from the single writer only.
+ *
+ *  @param   snapshot [in,out] : Pointer to the snapshot.
+ *  @param   source   [in]     : Pointer to the new value, snapshot->size bytes long.
+ *
+ *  @return  MEM_snapshot_status_t - Returns the operation status, which can be:
+ *              * SNAPSHOT_OK           : Value published.
+ *              * SNAPSHOT_BAD_ADDRESS  : Error due to a null pointer.
+ **/
+MEM_snapshot_status_t MEM_snapshotPublish(MEM_snapshot_t *snapshot, const void *source);
+
+/**
+ *  @fn      MEM_snapshotTryRead
+ *  @package memory_snapshot
+ *
+ *  @brief   Makes one attempt at copying a consistent value out of the snapshot.
+ *
+ *  @param   snapshot [in]  : Pointer to the snapshot.
+ *  @param   destine  [out] : Pointer to the destination, snapshot->size bytes long.
+ *
+ *  @return  MEM_snapshot_status_t - Returns the operation status, which can be:
+ *              * SNAPSHOT_OK           : Destination holds a consistent value.
+ *              * SNAPSHOT_TORN         : A publish overlapped the copy; destination content is undefined.
+ *              * SNAPSHOT_BAD_ADDRESS  : Error due to a null pointer.
+ **/
+MEM_snapshot_status_t MEM_snapshotTryRead(const MEM_snapshot_t *snapshot, void *destine);
+
+/**
+ *  @fn      MEM_snapshotRead
+ *  @package memory_snapshot
+ *
+ *  @brief   Copies a consistent value out of the snapshot, retrying while a publish overlaps the copy.
+ *
+ *  @param   snapshot [in]  : Pointer to the snapshot.
+ *  @param   destine  [out] : Pointer to the destination, snapshot->size bytes long.
+ *
+ *  @return  MEM_snapshot_status_t - Returns the operation status, which can be:
+ *              * SNAPSHOT_OK           : Destination holds a consistent value.
+ *              * SNAPSHOT_BAD_ADDRESS  : Error due to a null pointer.
+ **/
+MEM_snapshot_status_t MEM_snapshotRead(const MEM_snapshot_t *snapshot, void *destine);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_SNAPSHOT_H_ */
+/**@}*/
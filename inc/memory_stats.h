@@ -0,0 +1,228 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_stats
+ *  @{
+ *
+ *  @package    memory_stats
+ *  @brief      Optional per-call statistics of the compare, copy and fill entry points.
+ *
+ *  @file       memory_stats.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              With MEM_CONFIG_STATS=1 every call of MEM_compareStructs, MEM_copyStruct, MEM_fillStruct and
+ *              their Unchecked variants that passes argument validation records its operation, byte count and
+ *              alignment class. It also records a log2 bucket of its size and a log2 bucket of its latency in
+ *              MEM_CYCLE_COUNTER ticks. With MEM_CONFIG_STATS=0 the recording macros expand to nothing and the
+ *              kernels are unchanged.
+ *
+ *              MEM_STATS_CONTEXT() picks the counter block of the running context, which keeps contexts apart
+ *              as far as the blocks go:
+ *              - Cortex-M: block 0 in thread mode, block 1 in any exception handler. Handlers that preempt
+ *                each other share block 1. Under an RTOS every thread runs in thread mode and shares block 0,
+ *                so a context switch can land in the middle of another thread's update. Map each preemption
+ *                level or thread to its own block by defining MEM_STATS_CONTEXT() and MEM_STATS_CONTEXTS to
+ *                spread the load.
+ *              - Host: each thread takes the next block on its first call. Threads beyond MEM_STATS_CONTEXTS
+ *                wrap around and share blocks.
+ *              Because a block can always be shared, every counter is updated with a relaxed atomic add
+ *              (LDREX/STREX on Cortex-M, which also holds across preemption), so sharing costs throughput but
+ *              never loses a count.
+ *
+ *              Key functionalities include:
+ *              - **MEM_getStats**: Sums every context into one snapshot.
+ *              - **MEM_resetStats**: Clears every context.
+ *
+ *  @note
+ *              - A snapshot taken while other contexts are recording may be off by the calls in flight.
+ *
+ *  @see        - memory_config.h
+ **/
+
+#ifndef MEMORY_STATS_H_
+#define MEMORY_STATS_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *          PUBLIC DEFINES         *
+ * ================================*/
+
+/**
+ * @def MEM_STATS_BUCKETS
+ * @brief Log2 histogram buckets: bucket 0 holds 0, bucket n holds [2^(n-1), 2^n), the last one everything above.
+ **/
+#define MEM_STATS_BUCKETS           (33u)
+
+/**
+ * @def MEM_STATS_CONTEXTS
+ * @brief Number of per-context counter blocks.
+ **/
+#ifndef MEM_STATS_CONTEXTS
+#if defined(__arm__)
+#define MEM_STATS_CONTEXTS          (2u)
+#else
+#define MEM_STATS_CONTEXTS          (16u)
+#endif
+#endif
+
+/* =================================
+ *      PUBLIC STATUS ENUMS     *
+ * ================================*/
+
+/**
+ * @enum statsStatus
+ * @brief Enumeration to define the possible states of a statistics operation.
+ * @package memory_stats
+ *
+ * @typedef MEM_stats_status_t
+ **/
+typedef enum statsStatus
+{
+    STATS_OK                = (uint8_t)(0u), /**< Operation completed successfully */
+    STATS_DISABLED          = (uint8_t)(1u), /**< Built with MEM_CONFIG_STATS=0; the snapshot is all zero */
+    STATS_BAD_ADDRESS       = -(EFAULT)      /**< NULL pointer */
+} MEM_stats_status_t;
+
+/**
+ * @enum statsOperation
+ * @brief Recorded operation.
+ * @package memory_stats
+ *
+ * @typedef MEM_stats_op_t
+ **/
+typedef enum statsOperation
+{
+    MEM_STATS_COMPARE       = 0,    /**< MEM_compareStructs, MEM_compareStructsUnchecked */
+    MEM_STATS_COPY          = 1,    /**< MEM_copyStruct, MEM_copyStructUnchecked */
+    MEM_STATS_FILL          = 2,    /**< MEM_fillStruct, MEM_fillStructUnchecked */
+    MEM_STATS_OP_COUNT      = 3     /**< Number of operations */
+} MEM_stats_op_t;
+
+/**
+ * @enum statsAlignment
+ * @brief Alignment class of a call, which decides whether the word and burst loops can run.
+ * @package memory_stats
+ *
+ * @typedef MEM_stats_align_t
+ **/
+typedef enum statsAlignment
+{
+    MEM_STATS_ALIGNED       = 0,    /**< Every pointer word aligned */
+    MEM_STATS_CO_ALIGNED    = 1,    /**< Same offset within a word, aligned after a byte head */
+    MEM_STATS_MISALIGNED    = 2,    /**< Different offsets: byte loop only */
+    MEM_STATS_ALIGN_COUNT   = 3     /**< Number of classes */
+} MEM_stats_align_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct memOpStats
+ * @brief Counters of one operation.
+ * @package memory_stats
+ *
+ * @typedef MEM_op_stats_t
+ **/
+typedef struct memOpStats
+{
+    uint32_t calls;                             /**< Recorded calls */
+    uint64_t bytes;                             /**< Bytes processed */
+    uint32_t align[MEM_STATS_ALIGN_COUNT];      /**< Calls per MEM_stats_align_t */
+    uint32_t size_hist[MEM_STATS_BUCKETS];      /**< Calls per log2 size bucket */
+    uint32_t cycle_hist[MEM_STATS_BUCKETS];     /**< Calls per log2 latency bucket, in MEM_CYCLE_COUNTER ticks */
+} MEM_op_stats_t;
+
+/**
+ * @struct memStats
+ * @brief Counters of every operation.
+ * @package memory_stats
+ *
+ * @typedef MEM_stats_t
+ **/
+typedef struct memStats
+{
+    MEM_op_stats_t op[MEM_STATS_OP_COUNT];      /**< Indexed by MEM_stats_op_t */
+} MEM_stats_t;
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_getStats
+ *  @package memory_stats
+ *
+ *  @brief   Sums the counters of every context into a snapshot.
+ *
+ *  @param   stats [out] : Pointer to the snapshot.
+ *
+ *  @return  MEM_stats_status_t - Returns the operation status, which can be:
+ *              * STATS_OK              : Snapshot taken.
+ *              * STATS_DISABLED        : Statistics are compiled out; the snapshot is zeroed.
+ *              * STATS_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+MEM_stats_status_t MEM_getStats(MEM_stats_t *stats);
+
+/**
+ *  @fn      MEM_resetStats
+ *  @package memory_stats
+ *
+ *  @brief   Clears the counters of every context.
+ *
+ *  @return  MEM_stats_status_t - STATS_OK, or STATS_DISABLED when statistics are compiled out.
+ **/
+MEM_stats_status_t MEM_resetStats(void);
+
+/**
+ *  @fn      MEM_statsRecord
+ *  @package memory_stats
+ *
+ *  @brief   Records one call in the block of the current context. Called by the MEM_STATS_END hook.
+ *
+ *  @param   operation [in] : Recorded operation.
+ *  @param   ptr_a     [in] : First pointer of the call.
+ *  @param   ptr_b     [in] : Second pointer of the call; the same as ptr_a for fills.
+ *  @param   size      [in] : Size of the call in bytes.
+ *  @param   cycles    [in] : Latency of the call in MEM_CYCLE_COUNTER ticks.
+ **/
+void MEM_statsRecord(MEM_stats_op_t operation, const void *ptr_a, const void *ptr_b, size_t size, uint32_t cycles);
+
+/**
+ * @def MEM_STATS_BEGIN
+ * @brief Starts timing a call; place before the kernel.
+ *
+ * @def MEM_STATS_END
+ * @brief Records the call timed by MEM_STATS_BEGIN; place after the kernel.
+ **/
+#if (MEM_CONFIG_STATS != 0)
+#define MEM_STATS_BEGIN()                                   const uint32_t mem_stats_start = MEM_CYCLE_COUNTER()
+#define MEM_STATS_END(operation, ptr_a, ptr_b, size)                                                    \
+    MEM_statsRecord((operation), (ptr_a), (ptr_b), (size), (uint32_t)(MEM_CYCLE_COUNTER() - mem_stats_start))
+#else
+#define MEM_STATS_BEGIN()                                   ((void)0)
+#define MEM_STATS_END(operation, ptr_a, ptr_b, size)        ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_STATS_H_ */
+/**@}*/
@@ -0,0 +1,239 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_tlsf
+ *  @{
+ *
+ *  @package    memory_tlsf
+ *  @brief      Two-Level Segregated Fit (TLSF) allocator for variable-size blocks with bounded,
+ *              constant-time allocation and release.
+ *
+ *  @file       memory_tlsf.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The TLSF allocator manages one or more caller-supplied memory regions. Free blocks are kept in
+ *              segregated lists indexed by a first level (power of two of the size) and a second level
+ *              (linear subdivision of that power of two). Two bitmaps record which lists are non-empty, so
+ *              finding a suitable block is a pair of CLZ instructions instead of a list walk.
+ *
+ *              Key functionalities include:
+ *              - **MEM_tlsfInit**: Resets an allocator control block.
+ *              - **MEM_tlsfAddRegion**: Hands a memory region to the allocator.
+ *              - **MEM_tlsfMalloc**: Allocates a block in O(1).
+ *              - **MEM_tlsfFree**: Releases a block in O(1), coalescing with its physical neighbours.
+ *
+ *  @note
+ *              - The allocator is not reentrant: guard calls from different contexts with a lock of your choice.
+ *              - Returned blocks are aligned to MEM_TLSF_ALIGN_SIZE bytes.
+ *
+ *  @see        - memory_tlsf.h
+ **/
+
+#ifndef MEMORY_TLSF_H_
+#define MEMORY_TLSF_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *          PUBLIC DEFINES         *
+ * ================================*/
+
+/**
+ * @def MEM_TLSF_ALIGN_LOG2
+ * @brief Log2 of the block alignment: one machine word.
+ **/
+#if (UINTPTR_MAX > 0xFFFFFFFFu)
+#define MEM_TLSF_ALIGN_LOG2         (3u)
+#else
+#define MEM_TLSF_ALIGN_LOG2         (2u)
+#endif
+
+/**
+ * @def MEM_TLSF_ALIGN_SIZE
+ * @brief Alignment, in bytes, of every block returned by the allocator.
+ **/
+#define MEM_TLSF_ALIGN_SIZE         (1u << MEM_TLSF_ALIGN_LOG2)
+
+/**
+ * @def MEM_TLSF_SL_INDEX_LOG2
+ * @brief Log2 of the number of second-level lists per first-level class.
+ **/
+#define MEM_TLSF_SL_INDEX_LOG2      (4u)
+
+/**
+ * @def MEM_TLSF_SL_INDEX_COUNT
+ * @brief Number of second-level lists per first-level class.
+ **/
+#define MEM_TLSF_SL_INDEX_COUNT     (1u << MEM_TLSF_SL_INDEX_LOG2)
+
+/**
+ * @def MEM_TLSF_FL_INDEX_MAX
+ * @brief Log2 of the largest block size the allocator can manage (1 GiB).
+ **/
+#define MEM_TLSF_FL_INDEX_MAX       (30u)
+
+/**
+ * @def MEM_TLSF_FL_INDEX_SHIFT
+ * @brief First-level index of the smallest linear class: sizes below 2^shift share first-level slot 0.
+ **/
+#define MEM_TLSF_FL_INDEX_SHIFT     (MEM_TLSF_SL_INDEX_LOG2 + MEM_TLSF_ALIGN_LOG2)
+
+/**
+ * @def MEM_TLSF_FL_INDEX_COUNT
+ * @brief Number of first-level classes.
+ **/
+#define MEM_TLSF_FL_INDEX_COUNT     (MEM_TLSF_FL_INDEX_MAX - MEM_TLSF_FL_INDEX_SHIFT + 1u)
+
+/* =================================
+ *      PUBLIC STATUS ENUMS     *
+ * ================================*/
+
+/**
+ * @enum tlsfStatus
+ * @brief Enumeration to define the possible states of an allocator operation.
+ * @package memory_tlsf
+ *
+ * @typedef MEM_tlsf_status_t
+ **/
+typedef enum tlsfStatus
+{
+    TLSF_OK                 = (uint8_t)(0u), /**< Operation completed successfully */
+    TLSF_NOT_ALLOCATED      = (uint8_t)(1u), /**< Block is already free */
+    TLSF_REGION_TOO_SMALL   = (uint8_t)(2u), /**< Region cannot hold a single block */
+    TLSF_BAD_ALIGNMENT      = -(EINVAL),     /**< Region is not aligned to MEM_TLSF_ALIGN_SIZE */
+    TLSF_BAD_ADDRESS        = -(EFAULT)      /**< NULL pointer */
+} MEM_tlsf_status_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct tlsfBlock
+ * @brief Header of a physical block. Only the size field is live while the block is in use.
+ * @package memory_tlsf
+ *
+ * @typedef MEM_tlsf_block_t
+ **/
+typedef struct tlsfBlock
+{
+    struct tlsfBlock *prev_phys;    /**< Previous physical block, valid only when it is free */
+    size_t            size;         /**< Payload size; bit 0 = block free, bit 1 = previous block free */
+    struct tlsfBlock *next_free;    /**< Next block in the same free list */
+    struct tlsfBlock *prev_free;    /**< Previous block in the same free list */
+} MEM_tlsf_block_t;
+
+/**
+ * @struct tlsfControl
+ * @brief Allocator control block: free-list heads and the two-level bitmaps.
+ * @package memory_tlsf
+ *
+ * @typedef MEM_tlsf_t
+ **/
+typedef struct tlsfControl
+{
+    MEM_tlsf_block_t  null_block;                                              /**< Sentinel for empty lists */
+    uint32_t          fl_bitmap;                                               /**< Non-empty first-level classes */
+    uint32_t          sl_bitmap[MEM_TLSF_FL_INDEX_COUNT];                      /**< Non-empty second-level lists */
+    MEM_tlsf_block_t *blocks[MEM_TLSF_FL_INDEX_COUNT][MEM_TLSF_SL_INDEX_COUNT]; /**< Free-list heads */
+} MEM_tlsf_t;
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_tlsfInit
+ *  @package memory_tlsf
+ *
+ *  @brief   Resets an allocator control block to the empty state.
+ *
+ *  @param   tlsf [out] : Pointer to the control block.
+ *
+ *  @return  MEM_tlsf_status_t - Returns the operation status, which can be:
+ *              * TLSF_OK               : Control block initialized.
+ *              * TLSF_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_tlsf_status_t MEM_tlsfInit(MEM_tlsf_t *tlsf);
+
+/**
+ *  @fn      MEM_tlsfAddRegion
+ *  @package memory_tlsf
+ *
+ *  @brief   Hands a caller-supplied memory region to the allocator.
+ *
+ *  @details The region becomes one free block followed by a zero-sized sentinel. Several regions may be added
+ *           to the same control block; blocks never coalesce across regions.
+ *
+ *  @param   tlsf   [in,out] : Pointer to the control block.
+ *  @param   region [in]     : Start of the region, aligned to MEM_TLSF_ALIGN_SIZE.
+ *  @param   size   [in]     : Size of the region in bytes.
+ *
+ *  @return  MEM_tlsf_status_t - Returns the operation status, which can be:
+ *              * TLSF_OK               : Region added.
+ *              * TLSF_REGION_TOO_SMALL : Region cannot hold a block, or exceeds the largest block size.
+ *              * TLSF_BAD_ALIGNMENT    : Region is misaligned.
+ *              * TLSF_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_tlsf_status_t MEM_tlsfAddRegion(MEM_tlsf_t *tlsf, void *region, size_t size);
+
+/**
+ *  @fn      MEM_tlsfMalloc
+ *  @package memory_tlsf
+ *
+ *  @brief   Allocates a block of at least the requested size in constant time.
+ *
+ *  @param   tlsf [in,out] : Pointer to the control block.
+ *  @param   size [in]     : Requested size in bytes.
+ *
+ *  @return  void* - Pointer to the block, or NULL when no block is large enough or size is zero.
+ **/
+void *MEM_tlsfMalloc(MEM_tlsf_t *tlsf, size_t size);
+
+/**
+ *  @fn      MEM_tlsfFree
+ *  @package memory_tlsf
+ *
+ *  @brief   Releases a block in constant time, merging it with free physical neighbours.
+ *
+ *  @param   tlsf [in,out] : Pointer to the control block.
+ *  @param   ptr  [in]     : Block returned by MEM_tlsfMalloc.
+ *
+ *  @return  MEM_tlsf_status_t - Returns the operation status, which can be:
+ *              * TLSF_OK               : Block released.
+ *              * TLSF_NOT_ALLOCATED    : Block was already free.
+ *              * TLSF_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+MEM_tlsf_status_t MEM_tlsfFree(MEM_tlsf_t *tlsf, void *ptr);
+
+/**
+ *  @fn      MEM_tlsfBlockSize
+ *  @package memory_tlsf
+ *
+ *  @brief   Returns the usable size of an allocated block.
+ *
+ *  @param   ptr [in] : Block returned by MEM_tlsfMalloc.
+ *
+ *  @return  size_t - Usable size in bytes, or zero for a null pointer.
+ **/
+size_t MEM_tlsfBlockSize(const void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_TLSF_H_ */
+/**@}*/
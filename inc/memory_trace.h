@@ -0,0 +1,220 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_trace
+ *  @{
+ *
+ *  @package    memory_trace
+ *  @brief      Optional capture of the compare, copy and fill calls into a binary ring for offline replay.
+ *
+ *  @file       memory_trace.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              With MEM_CONFIG_TRACE=1 every call of MEM_compareStructs, MEM_copyStruct, MEM_fillStruct and
+ *              their Unchecked variants that passes argument validation appends a 12-byte MEM_trace_record_t
+ *              to a static ring of MEM_TRACE_RECORDS entries. Each record holds the operation, the size, the
+ *              offset of each pointer within a cache line and a MEM_CYCLE_COUNTER timestamp. When the ring is
+ *              full the oldest records are overwritten, so the ring always holds the latest traffic. With
+ *              MEM_CONFIG_TRACE=0 the hook expands to nothing.
+ *
+ *              MEM_traceDump serializes the ring, oldest record first, behind a MEM_trace_header_t. Write the
+ *              dump to a file on a host, or read it out of the target with the debugger, e.g.
+ *              "dump binary memory trace.bin buf buf+len" in gdb. bench/memory_replay.c replays the file
+ *              against whichever kernel set it is linked with.
+ *
+ *              Key functionalities include:
+ *              - **MEM_traceDump**: Serializes the captured records.
+ *              - **MEM_traceReset**: Discards the captured records.
+ *
+ *  @note
+ *              - Recording is safe from any thread or exception handler: each record claims its slot with an
+ *                atomic increment. A dump taken while other contexts record may contain a record that is
+ *                still being written; dump from a quiet point for exact traces.
+ *              - Records are stored in the byte order of the target. Cortex-M and x86 are both little-endian.
+ *
+ *  @see        - memory_config.h
+ *  @see        - memory_stats.h
+ **/
+
+#ifndef MEMORY_TRACE_H_
+#define MEMORY_TRACE_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory_config.h"
+#include "memory_stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *          PUBLIC DEFINES         *
+ * ================================*/
+
+/**
+ * @def MEM_TRACE_RECORDS
+ * @brief Capacity of the trace ring in records; must be a power of two.
+ **/
+#ifndef MEM_TRACE_RECORDS
+#define MEM_TRACE_RECORDS           (1024u)
+#endif
+
+#if (MEM_TRACE_RECORDS == 0u) || ((MEM_TRACE_RECORDS & (MEM_TRACE_RECORDS - 1u)) != 0u)
+#error "MEM_TRACE_RECORDS must be a power of two"
+#endif
+
+/**
+ * @def MEM_TRACE_LINE
+ * @brief Pointer offsets are recorded modulo this many bytes (one cache line).
+ **/
+#define MEM_TRACE_LINE              (64u)
+
+/**
+ * @def MEM_TRACE_MAGIC
+ * @brief First word of a dump: "MEMT" in little-endian byte order.
+ **/
+#define MEM_TRACE_MAGIC             (0x544D454Du)
+
+/**
+ * @def MEM_TRACE_VERSION
+ * @brief Dump format version.
+ **/
+#define MEM_TRACE_VERSION           (1u)
+
+/* =================================
+ *      PUBLIC STATUS ENUMS     *
+ * ================================*/
+
+/**
+ * @enum traceStatus
+ * @brief Enumeration to define the possible states of a trace operation.
+ * @package memory_trace
+ *
+ * @typedef MEM_trace_status_t
+ **/
+typedef enum traceStatus
+{
+    TRACE_OK                = (uint8_t)(0u), /**< Operation completed successfully */
+    TRACE_DISABLED          = (uint8_t)(1u), /**< Built with MEM_CONFIG_TRACE=0; the dump holds no record */
+    TRACE_NO_SPACE          = -(ENOSPC),     /**< Output buffer smaller than the dump */
+    TRACE_BAD_ADDRESS       = -(EFAULT)      /**< NULL pointer */
+} MEM_trace_status_t;
+
+/* =================================
+ *          PUBLIC TYPES           *
+ * ================================*/
+
+/**
+ * @struct memTraceRecord
+ * @brief One captured call.
+ * @package memory_trace
+ *
+ * @typedef MEM_trace_record_t
+ **/
+typedef struct memTraceRecord
+{
+    uint32_t timestamp;         /**< MEM_CYCLE_COUNTER() at entry */
+    uint32_t size;              /**< Size in bytes, saturated at UINT32_MAX */
+    uint8_t  operation;         /**< MEM_stats_op_t */
+    uint8_t  src_offset;        /**< Source (compare: first) pointer modulo MEM_TRACE_LINE */
+    uint8_t  dst_offset;        /**< Destination (compare: second) pointer modulo MEM_TRACE_LINE */
+    uint8_t  reserved;          /**< Zero */
+} MEM_trace_record_t;
+
+/**
+ * @struct memTraceHeader
+ * @brief Header of a dump, followed by count records.
+ * @package memory_trace
+ *
+ * @typedef MEM_trace_header_t
+ **/
+typedef struct memTraceHeader
+{
+    uint32_t magic;             /**< MEM_TRACE_MAGIC */
+    uint16_t version;           /**< MEM_TRACE_VERSION */
+    uint16_t record_size;       /**< sizeof(MEM_trace_record_t) */
+    uint32_t count;             /**< Records following the header */
+    uint32_t dropped;           /**< Older records overwritten before the dump */
+} MEM_trace_header_t;
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_traceDumpSize
+ *  @package memory_trace
+ *
+ *  @brief   Returns the number of bytes MEM_traceDump currently needs.
+ *
+ *  @return  size_t - Header plus captured records.
+ **/
+size_t MEM_traceDumpSize(void);
+
+/**
+ *  @fn      MEM_traceDump
+ *  @package memory_trace
+ *
+ *  @brief   Serializes the captured records, oldest first, behind a MEM_trace_header_t.
+ *
+ *  @param   buffer  [out] : Destination of the dump.
+ *  @param   size    [in]  : Size of the destination in bytes.
+ *  @param   written [out] : Optional; bytes written, or bytes needed on TRACE_NO_SPACE.
+ *
+ *  @return  MEM_trace_status_t - Returns the operation status, which can be:
+ *              * TRACE_OK              : Dump written.
+ *              * TRACE_DISABLED        : Tracing is compiled out; a header with no record is written.
+ *              * TRACE_NO_SPACE        : Buffer too small; nothing written.
+ *              * TRACE_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+MEM_trace_status_t MEM_traceDump(void *buffer, size_t size, size_t *written);
+
+/**
+ *  @fn      MEM_traceReset
+ *  @package memory_trace
+ *
+ *  @brief   Discards the captured records.
+ *
+ *  @return  MEM_trace_status_t - TRACE_OK, or TRACE_DISABLED when tracing is compiled out.
+ **/
+MEM_trace_status_t MEM_traceReset(void);
+
+/**
+ *  @fn      MEM_traceRecord
+ *  @package memory_trace
+ *
+ *  @brief   Appends one call to the ring. Called by the MEM_TRACE_RECORD hook.
+ *
+ *  @param   operation [in] : Recorded operation.
+ *  @param   source    [in] : Source pointer (compare: first structure; fill: the structure).
+ *  @param   destine   [in] : Destination pointer (compare: second structure; fill: the structure).
+ *  @param   size      [in] : Size of the call in bytes.
+ **/
+void MEM_traceRecord(MEM_stats_op_t operation, const void *source, const void *destine, size_t size);
+
+/**
+ * @def MEM_TRACE_RECORD
+ * @brief Records the call; place before the kernel.
+ **/
+#if (MEM_CONFIG_TRACE != 0)
+#define MEM_TRACE_RECORD(operation, source, destine, size)  MEM_traceRecord((operation), (source), (destine), (size))
+#else
+#define MEM_TRACE_RECORD(operation, source, destine, size)  ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_TRACE_H_ */
+/**@}*/
@@ -0,0 +1,100 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_wcet
+ *  @{
+ *
+ *  @package    memory_wcet
+ *  @brief      Worst-case cycle bounds of the compare, copy and fill kernels for schedulability analysis.
+ *
+ *  @file       memory_wcet.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              MEM_cycleBound returns an upper bound on the Cortex-M4 cycles of one call of MEM_compareStructs,
+ *              MEM_copyStruct or MEM_fillStruct (or their Unchecked variants), for the kernel set selected by
+ *              MEM_CONFIG_PROFILE. The bound splits each call into the phases its kernel executes:
+ *
+ *                  bound = setup + head * head_cost + bursts * burst_cost + words * word_cost
+ *                          + tail * tail_cost + rescan * tail_cost
+ *
+ *              - setup: call (a long call with MEM_CONFIG_RAMFUNC), argument checks, prologue/epilogue, loop
+ *                entry and exit.
+ *              - head: 0-3 bytes copied one at a time until the pointers are word aligned.
+ *              - bursts: LDM/STM blocks of 16 (BALANCED copy, SPEED compare) or 32 bytes (SPEED copy and fill).
+ *              - words: the remaining whole words, then tail: the remaining 0-3 bytes.
+ *              - rescan: bytes a compare re-reads one at a time after a differing word or burst.
+ *              Mutually misaligned buffers, and every call of the SIZE profile, run the byte loop on all bytes.
+ *              For co-aligned buffers the head length is unknown, so every head of 1 to 3 bytes is evaluated
+ *              and the largest cost is returned.
+ *
+ *              Per-instruction costs follow the Cortex-M4 TRM: ALU 1, taken branch 1 + P with P = 3 (worst
+ *              pipeline refill), not-taken branch 1, LDR/STR/LDRB/STRB 2, LDM/STM of N registers 1 + N. Each
+ *              data access adds MEM_CONFIG_WAIT_STATES cycles. The per-phase costs are the sums over the
+ *              instructions of memory_ops.c, listed in memory_wcet.c.
+ *
+ *  @note
+ *              - Excludes interrupts and preemption, bus contention with DMA or another master, and wait
+ *                states of instruction fetches. Run the kernels from zero-wait memory (MEM_CONFIG_RAMFUNC=1)
+ *                or add the flash penalty of the part.
+ *              - Excludes the MEM_CONFIG_STATS and MEM_CONFIG_TRACE hooks.
+ *              - The loops are assembly and are costed instruction by instruction. The C glue around them is
+ *                costed from the -O2 disassembly with every conditional branch taken, so a different compiler
+ *                or different flags must be rechecked with bench/memory_bench_m4.sh.
+ *              - What is checked: every instruction takes at least one cycle, so bench/memory_bench_m4.sh
+ *                flags a call whose instructions exceed the bound, a size step (one tail byte, one tail word,
+ *                one block) that adds more instructions than bound cycles, a co-aligned call with a 1-3 byte
+ *                head whose instructions exceed the co-aligned bound, a compare that stops on a difference in
+ *                its last byte, word or burst above the bound, and a MEM_CONFIG_RAMFUNC call above the bound.
+ *              - Not yet measured on hardware: a run of bench/memory_bench_m4.c built with -DBENCH_M4_CYCLES
+ *                (DWT cycle counts printed next to the bound) must stay below the bound as well.
+ *              - On targets other than Cortex-M4 the value is meaningless; the host kernels are libc calls.
+ *
+ *  @see        - memory_config.h
+ *  @see        - memory_stats.h
+ **/
+
+#ifndef MEMORY_WCET_H_
+#define MEMORY_WCET_H_
+
+/* =================================
+ *       PUBLIC INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <stddef.h>
+#include <stdint.h>
+
+#include "memory_config.h"
+#include "memory_stats.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* =================================
+ *    PUBLIC FUNCTION PROTOTYPES   *
+ * ================================*/
+
+/**
+ *  @fn      MEM_cycleBound
+ *  @package memory_wcet
+ *
+ *  @brief   Upper bound on the Cortex-M4 cycles of one compare, copy or fill call.
+ *
+ *  @param   operation [in] : Kernel: MEM_STATS_COMPARE, MEM_STATS_COPY or MEM_STATS_FILL.
+ *  @param   size      [in] : Size of the call in bytes.
+ *  @param   alignment [in] : Alignment class of the pointers. Fills only have one pointer, so MISALIGNED
+ *                            is treated as CO_ALIGNED.
+ *
+ *  @return  uint32_t - Cycle bound, saturated at UINT32_MAX; UINT32_MAX for an unknown operation or class.
+ **/
+uint32_t MEM_cycleBound(MEM_stats_op_t operation, size_t size, MEM_stats_align_t alignment);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* #ifndef MEMORY_WCET_H_ */
+/**@}*/
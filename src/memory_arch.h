@@ -0,0 +1,368 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_arch
+ *  @{
+ *
+ *  @package    memory_arch
+ *  @brief      Private architecture primitives shared by the memory modules: barriers and burst kernels.
+ *
+ *  @file       memory_arch.h
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Everything here is static inline so each module gets its own copy of the kernel inlined at the
+ *              call site. On ARM the kernels are Thumb-2 assembly; on any other target they fall back to the
+ *              compiler builtins so the modules can be exercised on a development host.
+ *
+ *  @note
+ *              - Not part of the public API: include it from src/ only.
+ *
+ *  @see        - memory_ops.h
+ **/
+
+#ifndef MEMORY_ARCH_H_
+#define MEMORY_ARCH_H_
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* dependencies: */
+#include <stddef.h>
+#include <stdint.h>
+
+#if !defined(__arm__)
+#include <string.h>
+#endif
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def ARCH_WORD_MASK
+ * @brief Mask of the address bits below one 32-bit word.
+ **/
+#define ARCH_WORD_MASK              ((uintptr_t)(3u))
+
+/* =================================
+ *     PRIVATE INLINE FUNCTIONS    *
+ * ================================*/
+
+/**
+ *  @fn      archBarrier
+ *  @package memory_arch
+ *
+ *  @brief   Full data memory barrier - ASSEMBLY: ARM (DMB).
+ *
+ *  @details Orders every memory access before the barrier against every access after it, for both the
+ *           compiler and the core. On the host it is a sequentially consistent fence.
+ **/
+static inline void archBarrier(void)
+{
+#if defined(__arm__)
+    asm volatile
+    (
+        "dmb                                \n\t"
+        :
+        :
+        : "memory"
+    );
+#else
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#endif
+}
+
+/**
+ *  @fn      archLoadRelaxed32
+ *  @package memory_arch
+ *
+ *  @brief   Loads a word that another context may store concurrently, with no ordering of its own.
+ *
+ *  @details A plain LDR on ARM. On the host it is an atomic load, so the access is not a data race and
+ *           ThreadSanitizer checks it; pair it with archBarrier where ordering is needed.
+ **/
+static inline uint32_t archLoadRelaxed32(const volatile uint32_t *word)
+{
+#if defined(__arm__)
+    return *word;
+#else
+    return __atomic_load_n(word, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @fn      archStoreRelaxed32
+ *  @package memory_arch
+ *
+ *  @brief   Stores a word that another context may load concurrently, with no ordering of its own.
+ **/
+static inline void archStoreRelaxed32(volatile uint32_t *word, uint32_t value)
+{
+#if defined(__arm__)
+    *word = value;
+#else
+    __atomic_store_n(word, value, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @fn      archLoadAcquire32
+ *  @package memory_arch
+ *
+ *  @brief   Loads a word with acquire ordering: later accesses cannot move above the load.
+ **/
+static inline uint32_t archLoadAcquire32(const volatile uint32_t *word)
+{
+    uint32_t value_out = 0u;
+
+#if defined(__arm__)
+    value_out = *word;
+    archBarrier();
+#else
+    value_out = __atomic_load_n(word, __ATOMIC_ACQUIRE);
+#endif
+
+    return value_out;
+}
+
+/**
+ *  @fn      archStoreRelease32
+ *  @package memory_arch
+ *
+ *  @brief   Stores a word with release ordering: earlier accesses cannot move below the store.
+ **/
+static inline void archStoreRelease32(volatile uint32_t *word, uint32_t value)
+{
+#if defined(__arm__)
+    archBarrier();
+    *word = value;
+#else
+    __atomic_store_n(word, value, __ATOMIC_RELEASE);
+#endif
+}
+
+/**
+ *  @fn      archFetchAdd32
+ *  @package memory_arch
+ *
+ *  @brief   Atomically adds to a word and returns its previous value - ASSEMBLY: ARM (LDREX/STREX).
+ *
+ *  @details Relaxed ordering: only the read-modify-write itself is atomic. An exception taken between
+ *           LDREX and STREX clears the monitor, so the loop also holds against preempting handlers.
+ **/
+static inline uint32_t archFetchAdd32(volatile uint32_t *word, uint32_t addend)
+{
+#if defined(__arm__)
+    uint32_t value_out = 0u;
+    uint32_t sum = 0u;
+    uint32_t failed = 0u;
+
+    asm volatile
+    (
+        "1:                                 \n\t"
+        "ldrex  %[value], [%[word]]         \n\t"
+        "add    %[sum], %[value], %[addend] \n\t"
+        "strex  %[failed], %[sum], [%[word]]\n\t"
+        "cmp    %[failed], #0               \n\t"
+        "bne    1b                          \n\t"
+        : [value] "=&r" (value_out), [sum] "=&r" (sum), [failed] "=&r" (failed)
+        : [word] "r" (word), [addend] "r" (addend)
+        : "cc", "memory"
+    );
+
+    return value_out;
+#else
+    return __atomic_fetch_add(word, addend, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @fn      archCopyBytes
+ *  @package memory_arch
+ *
+ *  @brief   Copies a few bytes one at a time - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details The head and tail loops of the word and burst kernels. Written in assembly so the compiler
+ *           cannot turn them into a memcpy call (GCC's loop distribution does that to the equivalent C loop),
+ *           which would leave the kernel calling into libc in flash. Four instructions per byte.
+ *
+ *  @param   destine [out] : Pointer to the destination bytes.
+ *  @param   source  [in]  : Pointer to the source bytes.
+ *  @param   size    [in]  : Number of bytes to copy; zero is allowed.
+ **/
+static inline void archCopyBytes(uint8_t *destine, const uint8_t *source, size_t size)
+{
+#if defined(__arm__)
+    asm volatile
+    (
+        "cmp %2, #0                         \n\t"
+        "beq 2f                             \n\t"
+        "1:                                 \n\t"
+        "ldrb r3, [%1], #1                  \n\t"
+        "strb r3, [%0], #1                  \n\t"
+        "subs %2, %2, #1                    \n\t"
+        "bne 1b                             \n\t"
+        "2:                                 \n\t"
+        : "=r" (destine), "=r" (source), "=r" (size)
+        : "0" (destine), "1" (source), "2" (size)
+        : "r3", "cc", "memory"
+    );
+#else
+    (void)memcpy(destine, source, size);
+#endif
+}
+
+/**
+ *  @fn      archCompareBytes
+ *  @package memory_arch
+ *
+ *  @brief   Compares a few bytes one at a time - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details The head loop of the word and burst compare kernels, in assembly like archCopyBytes so its
+ *           instruction sequence, and with it its cycle budget in memory_wcet.c, does not depend on the
+ *           compiler. Six instructions per byte.
+ *
+ *  @param   struct_a [in] : Pointer to the first bytes.
+ *  @param   struct_b [in] : Pointer to the second bytes.
+ *  @param   size     [in] : Number of bytes to compare; zero is allowed.
+ *
+ *  @return  size_t - 0 when the bytes are equal, non-zero otherwise.
+ **/
+static inline size_t archCompareBytes(const uint8_t *struct_a, const uint8_t *struct_b, size_t size)
+{
+#if defined(__arm__)
+    asm volatile
+    (
+        "cmp %2, #0                         \n\t"
+        "beq 2f                             \n\t"
+        "1:                                 \n\t"
+        "ldrb r2, [%0], #1                  \n\t"
+        "ldrb r3, [%1], #1                  \n\t"
+        "cmp r2, r3                         \n\t"
+        "bne 2f                             \n\t"
+        "subs %2, %2, #1                    \n\t"
+        "bne 1b                             \n\t"
+        "2:                                 \n\t"
+        : "=r" (struct_a), "=r" (struct_b), "=r" (size)
+        : "0" (struct_a), "1" (struct_b), "2" (size)
+        : "r2", "r3", "cc", "memory"
+    );
+
+    return size;
+#else
+    return (size_t)(memcmp(struct_a, struct_b, size) != 0);
+#endif
+}
+
+/**
+ *  @fn      archFillBytes
+ *  @package memory_arch
+ *
+ *  @brief   Stores a byte value a few times - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details The head and tail loops of the word and burst fill kernels, in assembly for the same reason as
+ *           archCopyBytes: the C loop becomes a memset call. Three instructions per byte.
+ *
+ *  @param   destine [out] : Pointer to the bytes to fill.
+ *  @param   value   [in]  : Byte value to store.
+ *  @param   size    [in]  : Number of bytes to store; zero is allowed.
+ **/
+static inline void archFillBytes(uint8_t *destine, uint8_t value, size_t size)
+{
+#if defined(__arm__)
+    asm volatile
+    (
+        "cmp %1, #0                         \n\t"
+        "beq 2f                             \n\t"
+        "1:                                 \n\t"
+        "strb %2, [%0], #1                  \n\t"
+        "subs %1, %1, #1                    \n\t"
+        "bne 1b                             \n\t"
+        "2:                                 \n\t"
+        : "=r" (destine), "=r" (size)
+        : "r" (value), "0" (destine), "1" (size)
+        : "cc", "memory"
+    );
+#else
+    (void)memset(destine, value, size);
+#endif
+}
+
+/**
+ *  @fn      archWordHead
+ *  @package memory_arch
+ *
+ *  @brief   Number of bytes before address reaches a word boundary, capped at size.
+ **/
+static inline size_t archWordHead(const void *address, size_t size)
+{
+    const size_t head = (size_t)((0u - (uintptr_t)address) & ARCH_WORD_MASK);
+
+    return (head < size) ? head : size;
+}
+
+/**
+ *  @fn      archBurstCopy
+ *  @package memory_arch
+ *
+ *  @brief   Copies a block using four-word LDM/STM bursts - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details When source and destination share the same word offset the leading bytes are copied one by one
+ *           until both are aligned, then the bulk moves 16 bytes per LDMIA/STMIA pair, followed by single
+ *           words and the trailing bytes. Mutually misaligned blocks are copied byte by byte. The byte loops
+ *           are archCopyBytes, so no path calls memcpy.
+ *
+ *  @param   destine [out] : Pointer to the destination block.
+ *  @param   source  [in]  : Pointer to the source block.
+ *  @param   size    [in]  : Number of bytes to copy; zero is allowed.
+ **/
+static inline void archBurstCopy(void *destine, const void *source, size_t size)
+{
+#if defined(__arm__)
+    uint8_t *dst = (uint8_t *)destine;
+    const uint8_t *src = (const uint8_t *)source;
+
+    if ((((uintptr_t)dst ^ (uintptr_t)src) & ARCH_WORD_MASK) == 0u)
+    {
+        const size_t head = archWordHead(dst, size);
+
+        archCopyBytes(dst, src, head);
+        dst += head;
+        src += head;
+        size -= head;
+
+        asm volatile
+        (
+            "cmp %2, #16                        \n\t"
+            "blo 2f                             \n\t"
+            "1:                                 \n\t"
+            "ldmia %1!, {r3, r4, r5, r12}       \n\t"
+            "stmia %0!, {r3, r4, r5, r12}       \n\t"
+            "sub %2, %2, #16                    \n\t"
+            "cmp %2, #16                        \n\t"
+            "bhs 1b                             \n\t"
+            "2:                                 \n\t"
+            "cmp %2, #4                         \n\t"
+            "blo 3f                             \n\t"
+            "ldr r3, [%1], #4                   \n\t"
+            "str r3, [%0], #4                   \n\t"
+            "sub %2, %2, #4                     \n\t"
+            "b 2b                               \n\t"
+            "3:                                 \n\t"
+            : "=r" (dst), "=r" (src), "=r" (size)
+            : "0" (dst), "1" (src), "2" (size)
+            : "r3", "r4", "r5", "r12", "cc", "memory"
+        );
+    }
+
+    archCopyBytes(dst, src, size);
+#else
+    (void)memcpy(destine, source, size);
+#endif
+}
+
+#endif /* #ifndef MEMORY_ARCH_H_ */
+/**@}*/
@@ -0,0 +1,271 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_atomic
+ *  @{
+ *
+ *  @package    memory_atomic
+ *  @brief      Tear-free copies of small shared structures (8 and 16 bytes) without a critical section.
+ *
+ *  @file       memory_atomic.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              The private side of each copy goes through archBurstCopy, so callers may pass unaligned
+ *              buffers; only the shared side is accessed with the atomic instruction sequence.
+ *              bench/memory_atomic_stress.c checks the copies and their ordering on the host, also under
+ *              ThreadSanitizer.
+ *
+ *  @see        - memory_atomic.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_atomic.h"
+
+/* dependencies: */
+#include "memory_arch.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def ATOMIC_IS_ALIGNED
+ * @brief Checks natural alignment of the shared location for a given size.
+ **/
+#define ATOMIC_IS_ALIGNED(ptr, size)    ((((uintptr_t)(ptr)) & ((uintptr_t)(size) - 1u)) == 0u)
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+
+/**
+ *  @fn      atomicCas128
+ *  @package memory_atomic
+ *
+ *  @brief   16-byte compare-and-swap - ASSEMBLY: x86_64 (LOCK CMPXCHG16B).
+ *
+ *  @details On failure the expected pair is updated with the current content of the location.
+ *
+ *  @return  int - Non-zero when the location held the expected pair and now holds the desired one.
+ **/
+static inline int atomicCas128(volatile void *location, uint64_t expected[2], const uint64_t desired[2])
+{
+    uint8_t swapped = 0u;
+
+    asm volatile
+    (
+        "lock cmpxchg16b %1                 \n\t"
+        "sete %0                            \n\t"
+        : "=q" (swapped), "+m" (*(volatile unsigned __int128 *)location),
+          "+a" (expected[0]), "+d" (expected[1])
+        : "b" (desired[0]), "c" (desired[1])
+        : "cc", "memory"
+    );
+
+    return (int)swapped;
+}
+
+#endif /* #if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u) */
+
+/* =================================
+ *   PUBLIC FUNCTION DEFINITION    *
+ * ================================*/
+
+/**
+ *  @fn      MEM_atomicLoad64
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 8 bytes out of a shared location without tearing - ASSEMBLY: ARM (LDREX/STREX).
+ *
+ *  @details The STREX writes the unchanged low word back, so on ARM the location must be writable. The
+ *           DMB after the loop gives the load acquire ordering, as on the host.
+ *
+ *  @param   source  [in]  : Shared location, 8-byte aligned and writable on ARM.
+ *  @param   destine [out] : Private destination, any alignment.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+
+MEM_struct_copy_t MEM_atomicLoad64(const volatile void *source, void *destine)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    uint32_t value[2] = { 0u, 0u };
+
+    if (source == NULL || destine == NULL || !ATOMIC_IS_ALIGNED(source, 8u))
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+#if defined(__arm__)
+    {
+        uint32_t failed = 0u;
+
+        asm volatile
+        (
+            "1:                                 \n\t"
+            "ldrex %0, [%3]                     \n\t"
+            "ldr %1, [%3, #4]                   \n\t"
+            "strex %2, %0, [%3]                 \n\t"
+            "cmp %2, #0                         \n\t"
+            "bne 1b                             \n\t"
+            : "=&r" (value[0]), "=&r" (value[1]), "=&r" (failed)
+            : "r" (source)
+            : "cc", "memory"
+        );
+
+        archBarrier();
+    }
+#else
+    {
+        uint64_t word = __atomic_load_n((const volatile uint64_t *)source, __ATOMIC_ACQUIRE);
+
+        archBurstCopy(value, &word, sizeof(word));
+    }
+#endif
+
+    archBurstCopy(destine, value, sizeof(value));
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_atomicStore64
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 8 bytes into a shared location without tearing - ASSEMBLY: ARM (STRD).
+ *
+ *  @details The DMB before the STRD gives the store release ordering, as on the host. The STRD itself can be
+ *           split by an interrupt, so no load may preempt it.
+ *
+ *  @param   source  [in]  : Private source, any alignment.
+ *  @param   destine [out] : Shared location, 8-byte aligned.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+
+MEM_struct_copy_t MEM_atomicStore64(const void *source, volatile void *destine)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    uint32_t value[2] = { 0u, 0u };
+
+    if (source == NULL || destine == NULL || !ATOMIC_IS_ALIGNED(destine, 8u))
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    archBurstCopy(value, source, sizeof(value));
+
+#if defined(__arm__)
+    archBarrier();
+
+    asm volatile
+    (
+        "strd %0, %1, [%2]                  \n\t"
+        :
+        : "r" (value[0]), "r" (value[1]), "r" (destine)
+        : "memory"
+    );
+#else
+    {
+        uint64_t word = 0u;
+
+        archBurstCopy(&word, value, sizeof(word));
+        __atomic_store_n((volatile uint64_t *)destine, word, __ATOMIC_RELEASE);
+    }
+#endif
+
+return_status:
+    return status_out;
+}
+
+#if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u)
+
+/**
+ *  @fn      MEM_atomicLoad128
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 16 bytes out of a shared location without tearing.
+ *
+ *  @param   source  [in]  : Shared location, 16-byte aligned and writable.
+ *  @param   destine [out] : Private destination, any alignment.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+
+MEM_struct_copy_t MEM_atomicLoad128(const volatile void *source, void *destine)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    uint64_t value[2] = { 0u, 0u };
+
+    if (source == NULL || destine == NULL || !ATOMIC_IS_ALIGNED(source, 16u))
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    /* Swapping zero for zero either stores what is already there or fails and returns the current pair. */
+    (void)atomicCas128((volatile void *)source, value, value);
+
+    archBurstCopy(destine, value, sizeof(value));
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_atomicStore128
+ *  @package memory_atomic
+ *
+ *  @brief   Copies 16 bytes into a shared location without tearing.
+ *
+ *  @param   source  [in]  : Private source, any alignment.
+ *  @param   destine [out] : Shared location, 16-byte aligned.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Value copied.
+ *              * COPY_BAD_ADDRESS      : Null pointer or misaligned shared location.
+ **/
+
+MEM_struct_copy_t MEM_atomicStore128(const void *source, volatile void *destine)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    uint64_t desired[2] = { 0u, 0u };
+    uint64_t expected[2] = { 0u, 0u };
+
+    if (source == NULL || destine == NULL || !ATOMIC_IS_ALIGNED(destine, 16u))
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    archBurstCopy(desired, source, sizeof(desired));
+
+    while (atomicCas128(destine, expected, desired) == 0)
+    {
+        /* expected now holds the current content; retry against it. */
+    }
+
+return_status:
+    return status_out;
+}
+
+#endif /* #if (MEM_ATOMIC_MAX_LOCK_FREE >= 16u) */
+
+/*** end of file ***/
@@ -29,6 +29,8 @@
  *  @note       
  *              - Ensure that memory operations are performed within the allocated memory boundaries to prevent corruption.
  *              - This module is thread-safe and can be used in multi-threaded applications without additional synchronization.
+ *                Each call is reentrant, but copying a buffer that another context is writing can still tear;
+ *                hand such data over through memory_snapshot.h instead.
  *              - Always initialize the memory module before performing any operations.
  *
  *  @see        - memory_ops.h
@@ -41,10 +43,301 @@
 /* implemented: */
 #include "memory_ops.h"
 
+/* dependencies: */
+#include "memory_arch.h"
+#include "memory_stats.h"
+#include "memory_trace.h"
+
+#if !defined(__arm__) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if !defined(__arm__) && defined(__SSSE3__)
+#include <tmmintrin.h>
+#endif
+
 /* =================================
  *   PRIVATE FUNCTION DECLARATION  *
  * ================================*/
 
+/**
+ *  @fn      compareKernel
+ *  @package memory_operations
+ *
+ *  @brief   Comparison loop of the profile selected by MEM_CONFIG_PROFILE - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details BALANCED compares a word per iteration and SPEED four words per LDM pair, both once the two
+ *           buffers are word aligned by archCompareBytes; a differing word or burst is handed back to the byte
+ *           loop, which is also the whole SIZE kernel.
+ *
+ *           With the DSP extension the SPEED burst is tested with USAD8 and three USADA8, which sum the
+ *           absolute byte differences of the four word pairs into one register: zero exactly when the bursts
+ *           are equal. That is five instructions (with the CMP) against four EORs and three ORRs.
+ **/
+static inline MEM_struct_compare_t compareKernel(const uint8_t *byte_a, const uint8_t *byte_b, size_t size)
+{
+    MEM_struct_compare_t status_out = STRUCTS_ARE_EQUAL;
+
+    if (size == 0u)
+    {
+        goto return_status;
+    }
+
+#if defined(__arm__)
+#if (MEM_CONFIG_PROFILE != MEM_PROFILE_SIZE)
+    if ((((uintptr_t)byte_a ^ (uintptr_t)byte_b) & ARCH_WORD_MASK) == 0u)
+    {
+        const size_t head = archWordHead(byte_a, size);
+
+        if (archCompareBytes(byte_a, byte_b, head) != 0u)
+        {
+            status_out = STRUCTS_ARENT_EQUAL;
+            goto return_status;
+        }
+
+        byte_a += head;
+        byte_b += head;
+        size -= head;
+
+        asm volatile
+        (
+#if (MEM_CONFIG_PROFILE == MEM_PROFILE_SPEED)
+            "cmp %2, #16                        \n\t"
+            "blo cmpk_words%=                   \n\t"
+            "cmpk_burst%=:                      \n\t"
+            "ldmia %0!, {r2, r3, r4, r5}        \n\t"
+            "ldmia %1!, {r6, r8, r9, r12}       \n\t"
+#if defined(__ARM_FEATURE_DSP)
+            "usad8 r2, r2, r6                   \n\t"
+            "usada8 r2, r3, r8, r2              \n\t"
+            "usada8 r2, r4, r9, r2              \n\t"
+            "usada8 r2, r5, r12, r2             \n\t"
+            "cmp r2, #0                         \n\t"
+#else
+            "eor r2, r2, r6                     \n\t"
+            "eor r3, r3, r8                     \n\t"
+            "eor r4, r4, r9                     \n\t"
+            "eor r5, r5, r12                    \n\t"
+            "orr r2, r2, r3                     \n\t"
+            "orr r4, r4, r5                     \n\t"
+            "orrs r2, r2, r4                    \n\t"
+#endif
+            "bne cmpk_back16%=                  \n\t"
+            "sub %2, %2, #16                    \n\t"
+            "cmp %2, #16                        \n\t"
+            "bhs cmpk_burst%=                   \n\t"
+#endif
+            "cmpk_words%=:                      \n\t"
+            "cmp %2, #4                         \n\t"
+            "blo cmpk_end%=                     \n\t"
+            "ldr r2, [%0], #4                   \n\t"
+            "ldr r3, [%1], #4                   \n\t"
+            "cmp r2, r3                         \n\t"
+            "bne cmpk_back4%=                   \n\t"
+            "sub %2, %2, #4                     \n\t"
+            "b cmpk_words%=                     \n\t"
+#if (MEM_CONFIG_PROFILE == MEM_PROFILE_SPEED)
+            "cmpk_back16%=:                     \n\t"
+            "sub %0, %0, #12                    \n\t"
+            "sub %1, %1, #12                    \n\t"
+#endif
+            "cmpk_back4%=:                      \n\t"
+            "sub %0, %0, #4                     \n\t"
+            "sub %1, %1, #4                     \n\t"
+            "cmpk_end%=:                        \n\t"
+            : "=r" (byte_a), "=r" (byte_b), "=r" (size)
+            : "0" (byte_a), "1" (byte_b), "2" (size)
+#if (MEM_CONFIG_PROFILE == MEM_PROFILE_SPEED)
+            : "r2", "r3", "r4", "r5", "r6", "r8", "r9", "r12", "cc", "memory"
+#else
+            : "r2", "r3", "cc", "memory"
+#endif
+        );
+
+        if (size == 0u)
+        {
+            goto return_status;
+        }
+    }
+#endif /* #if (MEM_CONFIG_PROFILE != MEM_PROFILE_SIZE) */
+
+    asm volatile
+    (
+        "cmp_loop%=:                        \n\t"
+        "ldrb r2, [%1], #1                  \n\t"
+        "ldrb r3, [%2], #1                  \n\t"
+        "cmp r2, r3                         \n\t"
+        "bne not_equal%=                    \n\t"
+        "subs %0, %0, #1                    \n\t"
+        "bne cmp_loop%=                     \n\t"
+        "b equal%=                          \n\t"
+
+        "not_equal%=:                       \n\t"
+        "mov %3, %4                         \n\t"
+        "b end%=                            \n\t"
+
+        "equal%=:                           \n\t"
+        "mov %3, %5                         \n\t"
+
+        "end%=:                             \n\t"
+        : "=r" (size), "=r" (byte_a), "=r" (byte_b), "=r" (status_out)
+        : "I" (STRUCTS_ARENT_EQUAL), "I" (STRUCTS_ARE_EQUAL), "0" (size), "1" (byte_a), "2" (byte_b)
+        : "r2", "r3", "cc", "memory"
+    );
+#else
+    if (memcmp(byte_a, byte_b, size) != 0)
+    {
+        status_out = STRUCTS_ARENT_EQUAL;
+    }
+#endif
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      copyKernel
+ *  @package memory_operations
+ *
+ *  @brief   Copy loop of the profile selected by MEM_CONFIG_PROFILE - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details SIZE copies byte by byte, BALANCED uses the four-word bursts of archBurstCopy and SPEED moves
+ *           eight words per LDM/STM pair when both blocks share the same word offset. Head and tail bytes go
+ *           through archCopyBytes, so no profile calls memcpy on ARM.
+ **/
+static inline void copyKernel(uint8_t *destine, const uint8_t *source, size_t size)
+{
+#if defined(__arm__) && (MEM_CONFIG_PROFILE == MEM_PROFILE_SIZE)
+    if (size != 0u)
+    {
+        asm volatile
+        (
+            "copy_loop%=:                       \n\t"
+            "ldrb r2, [%1], #1                  \n\t"
+            "strb r2, [%2], #1                  \n\t"
+            "subs %0, %0, #1                    \n\t"
+            "bne copy_loop%=                    \n\t"
+            : "=r" (size), "=r" (source), "=r" (destine)
+            : "0" (size), "1" (source), "2" (destine)
+            : "r2", "cc", "memory"
+        );
+    }
+#elif defined(__arm__) && (MEM_CONFIG_PROFILE == MEM_PROFILE_SPEED)
+    if ((((uintptr_t)destine ^ (uintptr_t)source) & ARCH_WORD_MASK) == 0u)
+    {
+        const size_t head = archWordHead(destine, size);
+
+        archCopyBytes(destine, source, head);
+        destine += head;
+        source += head;
+        size -= head;
+
+        asm volatile
+        (
+            "cmp %2, #32                        \n\t"
+            "blo copyk_words%=                  \n\t"
+            "copyk_burst%=:                     \n\t"
+            "ldmia %1!, {r3, r4, r5, r6, r8, r9, r10, r12} \n\t"
+            "stmia %0!, {r3, r4, r5, r6, r8, r9, r10, r12} \n\t"
+            "sub %2, %2, #32                    \n\t"
+            "cmp %2, #32                        \n\t"
+            "bhs copyk_burst%=                  \n\t"
+            "copyk_words%=:                     \n\t"
+            "cmp %2, #4                         \n\t"
+            "blo copyk_end%=                    \n\t"
+            "ldr r3, [%1], #4                   \n\t"
+            "str r3, [%0], #4                   \n\t"
+            "sub %2, %2, #4                     \n\t"
+            "b copyk_words%=                    \n\t"
+            "copyk_end%=:                       \n\t"
+            : "=r" (destine), "=r" (source), "=r" (size)
+            : "0" (destine), "1" (source), "2" (size)
+            : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory"
+        );
+    }
+
+    archCopyBytes(destine, source, size);
+#else
+    archBurstCopy(destine, source, size);
+#endif
+}
+
+/**
+ *  @fn      fillKernel
+ *  @package memory_operations
+ *
+ *  @brief   Fill loop of the profile selected by MEM_CONFIG_PROFILE - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details SIZE stores byte by byte. BALANCED stores the value replicated into a word once the pointer is
+ *           word aligned, and SPEED additionally stores eight such words per STM. Their head and tail bytes go
+ *           through archFillBytes, so no profile calls memset on ARM.
+ **/
+static inline void fillKernel(uint8_t *struct_ptr, size_t size, uint8_t value)
+{
+#if defined(__arm__) && (MEM_CONFIG_PROFILE == MEM_PROFILE_SIZE)
+    if (size != 0u)
+    {
+        asm volatile
+        (
+            "mov r2, %2                         \n\t"
+            "fill_loop%=:                       \n\t"
+            "strb r2, [%1], #1                  \n\t"
+            "subs %0, %0, #1                    \n\t"
+            "bne fill_loop%=                    \n\t"
+            : "=r" (size), "=r" (struct_ptr)
+            : "r" (value), "0" (size), "1" (struct_ptr)
+            : "r2", "cc", "memory"
+        );
+    }
+#elif defined(__arm__)
+    uint32_t pattern = (uint32_t)value * 0x01010101u;
+    const size_t head = archWordHead(struct_ptr, size);
+
+    archFillBytes(struct_ptr, value, head);
+    struct_ptr += head;
+    size -= head;
+
+    asm volatile
+    (
+#if (MEM_CONFIG_PROFILE == MEM_PROFILE_SPEED)
+        "mov r3, %2                         \n\t"
+        "mov r4, %2                         \n\t"
+        "mov r5, %2                         \n\t"
+        "mov r6, %2                         \n\t"
+        "mov r8, %2                         \n\t"
+        "mov r9, %2                         \n\t"
+        "mov r10, %2                        \n\t"
+        "mov r12, %2                        \n\t"
+        "cmp %1, #32                        \n\t"
+        "blo fillk_words%=                  \n\t"
+        "fillk_burst%=:                     \n\t"
+        "stmia %0!, {r3, r4, r5, r6, r8, r9, r10, r12} \n\t"
+        "sub %1, %1, #32                    \n\t"
+        "cmp %1, #32                        \n\t"
+        "bhs fillk_burst%=                  \n\t"
+#endif
+        "fillk_words%=:                     \n\t"
+        "cmp %1, #4                         \n\t"
+        "blo fillk_end%=                    \n\t"
+        "str %2, [%0], #4                   \n\t"
+        "sub %1, %1, #4                     \n\t"
+        "b fillk_words%=                    \n\t"
+        "fillk_end%=:                       \n\t"
+        : "=r" (struct_ptr), "=r" (size)
+        : "r" (pattern), "0" (struct_ptr), "1" (size)
+#if (MEM_CONFIG_PROFILE == MEM_PROFILE_SPEED)
+        : "r3", "r4", "r5", "r6", "r8", "r9", "r10", "r12", "cc", "memory"
+#else
+        : "cc", "memory"
+#endif
+    );
+
+    archFillBytes(struct_ptr, value, size);
+#else
+    (void)memset(struct_ptr, value, size);
+#endif
+}
+
 /**
  *  @fn      MEM_compareStructs
  *  @package memory_operations
@@ -53,6 +346,7 @@
  *
  *  @details This function performs a byte-by-byte comparison of two structures to determine if they are identical.
  *           It checks each byte until a difference is found or until the entire structure has been compared.
+ *           The kernel (byte, word or burst loop) is selected by MEM_CONFIG_PROFILE.
  *
  *  @param   struct_a [in]  : Pointer to the first structure.
  *  @param   struct_b [in]  : Pointer to the second structure.
@@ -64,7 +358,7 @@
  *              * COMPARE_BAD_ADDRESS     : Error due to a null pointer.
  **/
 
-MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct_b, size_t size)
+MEM_RAMFUNC MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct_b, size_t size)
 {
     MEM_struct_compare_t status_out = STRUCTS_ARE_EQUAL;
 
@@ -74,29 +368,12 @@ MEM_struct_compare_t MEM_compareStructs(const void *struct_a, const void *struct
         goto return_status;
     }
 
-    asm volatile 
-    (
-        "cmp_loop:                          \n\t"
-        "ldrb r2, [%1], #1                  \n\t"
-        "ldrb r3, [%2], #1                  \n\t"
-        "cmp r2, r3                         \n\t"
-        "bne not_equal                      \n\t"
-        "subs %0, %0, #1                    \n\t"
-        "bne cmp_loop                       \n\t"
-        "b equal                            \n\t"
-
-        "not_equal:                         \n\t"
-        "mov %3, %4                         \n\t"
-        "b end                              \n\t"
-
-        "equal:                             \n\t"
-        "mov %3, %5                         \n\t"
-
-        "end:                               \n\t"
-        : "=r" (size), "=r" (struct_a), "=r" (struct_b), "=r" (status_out)
-        : "I" (STRUCTS_ARENT_EQUAL), "I" (STRUCTS_ARE_EQUAL), "0" (size), "1" (struct_a), "2" (struct_b)
-        : "r2", "r3", "cc", "memory"
-    );
+    {
+        MEM_TRACE_RECORD(MEM_STATS_COMPARE, struct_a, struct_b, size);
+        MEM_STATS_BEGIN();
+        status_out = compareKernel((const uint8_t *)struct_a, (const uint8_t *)struct_b, size);
+        MEM_STATS_END(MEM_STATS_COMPARE, struct_a, struct_b, size);
+    }
 
 return_status:
     return status_out;
@@ -110,6 +387,7 @@ return_status:
  *
  *  @details This function copies the contents of one structure to another byte by byte. It is useful for duplicating
  *           structures or transferring data from one memory location to another.
+ *           The kernel (byte loop, four- or eight-word bursts) is selected by MEM_CONFIG_PROFILE.
  *
  *  @param   source  [in]  : Pointer to the source structure.
  *  @param   destine [out] : Pointer to the destination structure.
@@ -121,7 +399,7 @@ return_status:
  *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
  **/
 
-MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size)
+MEM_RAMFUNC MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size)
 {
     MEM_struct_copy_t status_out = STRUCT_COPIED;
 
@@ -130,19 +408,14 @@ MEM_struct_copy_t MEM_copyStruct(const void *source, void *destine, size_t size)
         status_out = COPY_BAD_ADDRESS;
         goto return_status;
     }
-    
-    asm volatile 
-    (
-        "copy_loop:                         \n\t"
-        "ldrb r2, [%1], #1                  \n\t"
-        "strb r2, [%2], #1                  \n\t"
-        "subs %0, %0, #1                    \n\t"
-        "bne copy_loop                      \n\t"
-        : "=r" (size), "=r" (source), "=r" (destine)
-        : "0" (size), "1" (source), "2" (destine)
-        : "r2", "cc", "memory"
-    );
-    
+
+    {
+        MEM_TRACE_RECORD(MEM_STATS_COPY, source, destine, size);
+        MEM_STATS_BEGIN();
+        copyKernel((uint8_t *)destine, (const uint8_t *)source, size);
+        MEM_STATS_END(MEM_STATS_COPY, source, destine, size);
+    }
+
 return_status:
     return status_out;
 }
@@ -155,6 +428,7 @@ return_status:
  *
  *  @details This function fills a structure with a specified value byte by byte. It is useful for initializing
  *           structures or resetting memory to a known state.
+ *           The kernel (byte loop, word loop or eight-word bursts) is selected by MEM_CONFIG_PROFILE.
  *
  *  @param   struct_ptr [out] : Pointer to the structure to be filled.
  *  @param   size       [in]  : Size of the structure to be filled.
@@ -165,7 +439,7 @@ return_status:
  *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
  **/
 
-MEM_struct_fill_t MEM_fillStruct(void *struct_ptr, size_t size, uint8_t value)
+MEM_RAMFUNC MEM_struct_fill_t MEM_fillStruct(void *struct_ptr, size_t size, uint8_t value)
 {
     MEM_struct_fill_t status_out = STRUCT_FILLED;
 
@@ -175,17 +449,2198 @@ MEM_struct_fill_t MEM_fillStruct(void *struct_ptr, size_t size, uint8_t value)
         goto return_status;
     }
 
-    asm volatile 
+    {
+        MEM_TRACE_RECORD(MEM_STATS_FILL, struct_ptr, struct_ptr, size);
+        MEM_STATS_BEGIN();
+        fillKernel((uint8_t *)struct_ptr, size, value);
+        MEM_STATS_END(MEM_STATS_FILL, struct_ptr, struct_ptr, size);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_compareStructsUnchecked
+ *  @package memory_operations
+ *
+ *  @brief   MEM_compareStructs without argument validation, for callers that guarantee valid pointers.
+ *
+ *  @details Asserts on a null pointer unless NDEBUG is defined; never returns COMPARE_BAD_ADDRESS.
+ *
+ *  @param   struct_a [in]  : Pointer to the first structure.
+ *  @param   struct_b [in]  : Pointer to the second structure.
+ *  @param   size     [in]  : Size of the structures to be compared.
+ *
+ *  @return  MEM_struct_compare_t - STRUCTS_ARE_EQUAL or STRUCTS_ARENT_EQUAL.
+ **/
+
+MEM_RAMFUNC MEM_struct_compare_t MEM_compareStructsUnchecked(const void *struct_a, const void *struct_b, size_t size)
+{
+    MEM_struct_compare_t status_out = STRUCTS_ARE_EQUAL;
+
+    MEM_ASSERT((struct_a != NULL) && (struct_b != NULL));
+
+    MEM_TRACE_RECORD(MEM_STATS_COMPARE, struct_a, struct_b, size);
+    MEM_STATS_BEGIN();
+    status_out = compareKernel((const uint8_t *)struct_a, (const uint8_t *)struct_b, size);
+    MEM_STATS_END(MEM_STATS_COMPARE, struct_a, struct_b, size);
+
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_copyStructUnchecked
+ *  @package memory_operations
+ *
+ *  @brief   MEM_copyStruct without argument validation, for callers that guarantee valid pointers.
+ *
+ *  @details Asserts on a null pointer unless NDEBUG is defined; never returns COPY_BAD_ADDRESS.
+ *
+ *  @param   source  [in]  : Pointer to the source structure.
+ *  @param   destine [out] : Pointer to the destination structure.
+ *  @param   size    [in]  : Size of the structure to be copied.
+ *
+ *  @return  MEM_struct_copy_t - Always STRUCT_COPIED.
+ **/
+
+MEM_RAMFUNC MEM_struct_copy_t MEM_copyStructUnchecked(const void *source, void *destine, size_t size)
+{
+    MEM_ASSERT((source != NULL) && (destine != NULL));
+
+    MEM_TRACE_RECORD(MEM_STATS_COPY, source, destine, size);
+    MEM_STATS_BEGIN();
+    copyKernel((uint8_t *)destine, (const uint8_t *)source, size);
+    MEM_STATS_END(MEM_STATS_COPY, source, destine, size);
+
+    return STRUCT_COPIED;
+}
+
+/**
+ *  @fn      MEM_fillStructUnchecked
+ *  @package memory_operations
+ *
+ *  @brief   MEM_fillStruct without argument validation, for callers that guarantee a valid pointer.
+ *
+ *  @details Asserts on a null pointer unless NDEBUG is defined; never returns FILL_BAD_ADDRESS.
+ *
+ *  @param   struct_ptr [out] : Pointer to the structure to be filled.
+ *  @param   size       [in]  : Size of the structure to be filled.
+ *  @param   value      [in]  : Value to be used to fill the structure.
+ *
+ *  @return  MEM_struct_fill_t - Always STRUCT_FILLED.
+ **/
+
+MEM_RAMFUNC MEM_struct_fill_t MEM_fillStructUnchecked(void *struct_ptr, size_t size, uint8_t value)
+{
+    MEM_ASSERT(struct_ptr != NULL);
+
+    MEM_TRACE_RECORD(MEM_STATS_FILL, struct_ptr, struct_ptr, size);
+    MEM_STATS_BEGIN();
+    fillKernel((uint8_t *)struct_ptr, size, value);
+    MEM_STATS_END(MEM_STATS_FILL, struct_ptr, struct_ptr, size);
+
+    return STRUCT_FILLED;
+}
+
+/**
+ *  @fn      MEM_ramfuncInit
+ *  @package memory_operations
+ *
+ *  @brief   Copies the .ramfunc section from its flash load address to RAM.
+ *
+ *  @details Runs from flash and uses a plain word loop: the kernels it loads are not usable yet. The
+ *           section boundaries come from ld/memory_ramfunc.ld and are word aligned.
+ **/
+
+void MEM_ramfuncInit(void)
+{
+#if defined(__arm__) && (MEM_CONFIG_RAMFUNC != 0)
+    extern uint32_t __ramfunc_load__[];
+    extern uint32_t __ramfunc_start__[];
+    extern uint32_t __ramfunc_end__[];
+
+    const uint32_t *source = __ramfunc_load__;
+    volatile uint32_t *destine = __ramfunc_start__;
+
+    while (destine < __ramfunc_end__)
+    {
+        *destine++ = *source++;
+    }
+
+    /* The copied code is fetched through the instruction bus: drain the stores and refetch. */
+    asm volatile
     (
-        "mov r2, %2                         \n\t"
-        "fill_loop:                         \n\t"
-        "strb r2, [%1], #1                  \n\t"
-        "subs %0, %0, #1                    \n\t"
-        "bne fill_loop                      \n\t"
-        : "=r" (size), "=r" (struct_ptr)
-        : "r" (value), "0" (size), "1" (struct_ptr)
-        : "r2", "cc", "memory"
+        "dsb                                \n\t"
+        "isb                                \n\t"
+        :
+        :
+        : "memory"
     );
+#endif
+}
+
+/**
+ *  @fn      MEM_compareMasked
+ *  @package memory_operations
+ *
+ *  @brief   Compares two structures considering only the bits set in a mask - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Computes (a ^ b) & mask one word at a time and stops at the first non-zero result, so padding
+ *           and reserved bits are ignored in the same pass as the comparison. The word loop runs when all
+ *           three buffers are word aligned; otherwise, and for the trailing bytes, it works byte by byte.
+ *
+ *  @param   struct_a [in]  : Pointer to the first structure.
+ *  @param   struct_b [in]  : Pointer to the second structure.
+ *  @param   mask     [in]  : Pointer to the mask; set bits are significant.
+ *  @param   size     [in]  : Size of the structures and of the mask.
+ *
+ *  @return  MEM_struct_compare_t - Returns the comparison status, which can be:
+ *              * STRUCTS_ARE_EQUAL       : Structures are equal under the mask.
+ *              * STRUCTS_ARENT_EQUAL     : Structures differ in at least one significant bit.
+ *              * COMPARE_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+
+MEM_struct_compare_t MEM_compareMasked(const void *struct_a, const void *struct_b, const void *mask, size_t size)
+{
+    MEM_struct_compare_t status_out = STRUCTS_ARE_EQUAL;
+    const uint8_t *byte_a = (const uint8_t *)struct_a;
+    const uint8_t *byte_b = (const uint8_t *)struct_b;
+    const uint8_t *byte_m = (const uint8_t *)mask;
+    size_t words = 0u;
+
+    if (struct_a == NULL || struct_b == NULL || mask == NULL)
+    {
+        status_out = COMPARE_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((((uintptr_t)byte_a | (uintptr_t)byte_b | (uintptr_t)byte_m) & ARCH_WORD_MASK) == 0u)
+    {
+        words = size >> 2;
+        size &= ARCH_WORD_MASK;
+    }
+
+    if (words != 0u)
+    {
+#if defined(__arm__)
+        asm volatile
+        (
+            "mask_loop%=:                       \n\t"
+            "ldr r2, [%1], #4                   \n\t"
+            "ldr r3, [%2], #4                   \n\t"
+            "ldr r4, [%3], #4                   \n\t"
+            "eors r2, r2, r3                    \n\t"
+            "ands r2, r2, r4                    \n\t"
+            "bne mask_end%=                     \n\t"
+            "subs %0, %0, #1                    \n\t"
+            "bne mask_loop%=                    \n\t"
+            "mask_end%=:                        \n\t"
+            : "=r" (words), "=r" (byte_a), "=r" (byte_b), "=r" (byte_m)
+            : "0" (words), "1" (byte_a), "2" (byte_b), "3" (byte_m)
+            : "r2", "r3", "r4", "cc", "memory"
+        );
+#else
+        while (words != 0u)
+        {
+            uint32_t word_a = 0u;
+            uint32_t word_b = 0u;
+            uint32_t word_m = 0u;
+
+            (void)memcpy(&word_a, byte_a, sizeof(word_a));
+            (void)memcpy(&word_b, byte_b, sizeof(word_b));
+            (void)memcpy(&word_m, byte_m, sizeof(word_m));
+
+            if (((word_a ^ word_b) & word_m) != 0u)
+            {
+                break;
+            }
+
+            byte_a += sizeof(uint32_t);
+            byte_b += sizeof(uint32_t);
+            byte_m += sizeof(uint32_t);
+            --words;
+        }
+#endif
+
+        /* The loop only leaves early on a significant difference. */
+        if (words != 0u)
+        {
+            status_out = STRUCTS_ARENT_EQUAL;
+            goto return_status;
+        }
+    }
+
+    while (size != 0u)
+    {
+        if (((*byte_a++ ^ *byte_b++) & *byte_m++) != 0u)
+        {
+            status_out = STRUCTS_ARENT_EQUAL;
+            goto return_status;
+        }
+
+        --size;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_buildMask
+ *  @package memory_operations
+ *
+ *  @brief   Builds a compare mask that selects the listed fields and clears everything else.
+ *
+ *  @param   mask   [out] : Pointer to the mask to build.
+ *  @param   size   [in]  : Size of the mask, equal to the size of the structure it describes.
+ *  @param   fields [in]  : Array of significant fields.
+ *  @param   count  [in]  : Number of entries in fields.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED        : Mask built.
+ *              * STRUCT_FILL_ERROR    : A field lies outside the mask.
+ *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+
+MEM_struct_fill_t MEM_buildMask(void *mask, size_t size, const MEM_field_t *fields, size_t count)
+{
+    MEM_struct_fill_t status_out = STRUCT_FILLED;
+    size_t index = 0u;
+
+    if (mask == NULL || (fields == NULL && count != 0u))
+    {
+        status_out = FILL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    for (index = 0u; index < count; ++index)
+    {
+        if (fields[index].offset > size || fields[index].size > size - fields[index].offset)
+        {
+            status_out = STRUCT_FILL_ERROR;
+            goto return_status;
+        }
+    }
+
+    if (size != 0u)
+    {
+        (void)MEM_fillStruct(mask, size, 0x00u);
+    }
+
+    for (index = 0u; index < count; ++index)
+    {
+        if (fields[index].size != 0u)
+        {
+            (void)MEM_fillStruct((uint8_t *)mask + fields[index].offset, fields[index].size, 0xFFu);
+        }
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_isFilled
+ *  @package memory_operations
+ *
+ *  @brief   Checks that every byte of a region holds a given value - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Intended for erase checks (0xFF) and zero checks. After a byte-wise head up to word alignment,
+ *           the region is scanned in four-word LDM bursts against the value replicated into a word. A
+ *           failing burst is rescanned byte by byte to locate the first deviating byte. With the DSP extension
+ *           the burst is tested with USAD8/USADA8 against the pattern, as in the SPEED compare.
+ *
+ *  @param   struct_ptr [in]  : Pointer to the region to check.
+ *  @param   size       [in]  : Size of the region in bytes.
+ *  @param   value      [in]  : Expected value of every byte.
+ *  @param   first_bad  [out] : Offset of the first deviating byte, or size when the region is filled; may be NULL.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED        : Every byte holds value.
+ *              * STRUCT_NOT_FILLED    : At least one byte differs; see first_bad.
+ *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+
+MEM_struct_fill_t MEM_isFilled(const void *struct_ptr, size_t size, uint8_t value, size_t *first_bad)
+{
+    MEM_struct_fill_t status_out = STRUCT_FILLED;
+    const uint8_t *byte_ptr = (const uint8_t *)struct_ptr;
+    size_t remaining = size;
+    uint32_t pattern = (uint32_t)value * 0x01010101u;
+
+    if (struct_ptr == NULL)
+    {
+        status_out = FILL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    while ((remaining != 0u) && (((uintptr_t)byte_ptr & ARCH_WORD_MASK) != 0u))
+    {
+        if (*byte_ptr != value)
+        {
+            goto not_filled;
+        }
+
+        ++byte_ptr;
+        --remaining;
+    }
+
+    /* Word scan: on a mismatch the pointer is rewound to the failing burst and remaining is left untouched,
+     * so the byte loop below pinpoints the deviating byte. */
+#if defined(__arm__)
+    asm volatile
+    (
+        "cmp %1, #16                        \n\t"
+        "blo verify_words%=                 \n\t"
+        "verify_burst%=:                    \n\t"
+        "ldmia %0!, {r2, r3, r4, r5}        \n\t"
+#if defined(__ARM_FEATURE_DSP)
+        "usad8 r2, r2, %2                   \n\t"
+        "usada8 r2, r3, %2, r2              \n\t"
+        "usada8 r2, r4, %2, r2              \n\t"
+        "usada8 r2, r5, %2, r2              \n\t"
+        "cmp r2, #0                         \n\t"
+#else
+        "eor r2, r2, %2                     \n\t"
+        "eor r3, r3, %2                     \n\t"
+        "eor r4, r4, %2                     \n\t"
+        "eor r5, r5, %2                     \n\t"
+        "orr r2, r2, r3                     \n\t"
+        "orr r4, r4, r5                     \n\t"
+        "orrs r2, r2, r4                    \n\t"
+#endif
+        "bne verify_back16%=                \n\t"
+        "sub %1, %1, #16                    \n\t"
+        "cmp %1, #16                        \n\t"
+        "bhs verify_burst%=                 \n\t"
+        "verify_words%=:                    \n\t"
+        "cmp %1, #4                         \n\t"
+        "blo verify_end%=                   \n\t"
+        "ldr r2, [%0], #4                   \n\t"
+        "cmp r2, %2                         \n\t"
+        "bne verify_back4%=                 \n\t"
+        "sub %1, %1, #4                     \n\t"
+        "b verify_words%=                   \n\t"
+        "verify_back16%=:                   \n\t"
+        "sub %0, %0, #16                    \n\t"
+        "b verify_end%=                     \n\t"
+        "verify_back4%=:                    \n\t"
+        "sub %0, %0, #4                     \n\t"
+        "verify_end%=:                      \n\t"
+        : "=r" (byte_ptr), "=r" (remaining)
+        : "r" (pattern), "0" (byte_ptr), "1" (remaining)
+        : "r2", "r3", "r4", "r5", "cc", "memory"
+    );
+#else
+    while (remaining >= sizeof(uint32_t))
+    {
+        uint32_t word = 0u;
+
+        (void)memcpy(&word, byte_ptr, sizeof(word));
+
+        if (word != pattern)
+        {
+            break;
+        }
+
+        byte_ptr += sizeof(uint32_t);
+        remaining -= sizeof(uint32_t);
+    }
+#endif
+
+    while (remaining != 0u)
+    {
+        if (*byte_ptr != value)
+        {
+            goto not_filled;
+        }
+
+        ++byte_ptr;
+        --remaining;
+    }
+
+    if (first_bad != NULL)
+    {
+        *first_bad = size;
+    }
+
+    goto return_status;
+
+not_filled:
+    status_out = STRUCT_NOT_FILLED;
+
+    if (first_bad != NULL)
+    {
+        *first_bad = (size_t)(byte_ptr - (const uint8_t *)struct_ptr);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_copyVerified
+ *  @package memory_operations
+ *
+ *  @brief   Copies a structure and reads every burst back right after storing it - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details When source and destination share the same word offset, the bulk moves in four-word bursts:
+ *           LDM from the source, STM to the destination, then the burst is reloaded from the destination and
+ *           XOR-compared with the registers it was stored from (USAD8/USADA8 with the DSP extension). A failing
+ *           burst is redone byte by byte to locate the first byte that does not read back. Mutually misaligned
+ *           blocks are verified per byte.
+ *
+ *  @param   source    [in]  : Pointer to the source structure.
+ *  @param   destine   [out] : Pointer to the destination structure.
+ *  @param   size      [in]  : Size of the structure to be copied.
+ *  @param   first_bad [out] : Offset of the first byte that did not read back, or size on success; may be NULL.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Structure copied and read back.
+ *              * STRUCT_NOT_COPIED     : A byte did not read back; see first_bad. Later bytes are not copied.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copyVerified(const void *source, void *destine, size_t size, size_t *first_bad)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    const uint8_t *src = (const uint8_t *)source;
+    volatile uint8_t *dst = (volatile uint8_t *)destine;
+    size_t remaining = size;
+
+    if (source == NULL || destine == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((((uintptr_t)src ^ (uintptr_t)dst) & ARCH_WORD_MASK) == 0u)
+    {
+        while ((remaining != 0u) && (((uintptr_t)dst & ARCH_WORD_MASK) != 0u))
+        {
+            *dst = *src;
+
+            if (*dst != *src)
+            {
+                goto not_copied;
+            }
+
+            ++src;
+            ++dst;
+            --remaining;
+        }
+
+        /* Burst loop: on a failed readback both pointers are rewound to the start of the burst and remaining
+         * is left untouched, so the byte loop below redoes it and pinpoints the failing byte. */
+#if defined(__arm__)
+        asm volatile
+        (
+            "cmp %2, #16                        \n\t"
+            "blo copyv_words%=                  \n\t"
+            "copyv_burst%=:                     \n\t"
+            "ldmia %1!, {r2, r3, r4, r5}        \n\t"
+            "stmia %0, {r2, r3, r4, r5}         \n\t"
+            "ldr r12, [%0]                      \n\t"
+#if defined(__ARM_FEATURE_DSP)
+            "usad8 r2, r2, r12                  \n\t"
+            "ldr r12, [%0, #4]                  \n\t"
+            "usada8 r2, r3, r12, r2             \n\t"
+            "ldr r12, [%0, #8]                  \n\t"
+            "usada8 r2, r4, r12, r2             \n\t"
+            "ldr r12, [%0, #12]                 \n\t"
+            "usada8 r2, r5, r12, r2             \n\t"
+            "cmp r2, #0                         \n\t"
+#else
+            "eor r2, r2, r12                    \n\t"
+            "ldr r12, [%0, #4]                  \n\t"
+            "eor r3, r3, r12                    \n\t"
+            "ldr r12, [%0, #8]                  \n\t"
+            "eor r4, r4, r12                    \n\t"
+            "ldr r12, [%0, #12]                 \n\t"
+            "eor r5, r5, r12                    \n\t"
+            "orr r2, r2, r3                     \n\t"
+            "orr r4, r4, r5                     \n\t"
+            "orrs r2, r2, r4                    \n\t"
+#endif
+            "bne copyv_back16%=                 \n\t"
+            "add %0, %0, #16                    \n\t"
+            "sub %2, %2, #16                    \n\t"
+            "cmp %2, #16                        \n\t"
+            "bhs copyv_burst%=                  \n\t"
+            "copyv_words%=:                     \n\t"
+            "cmp %2, #4                         \n\t"
+            "blo copyv_end%=                    \n\t"
+            "ldr r2, [%1], #4                   \n\t"
+            "str r2, [%0]                       \n\t"
+            "ldr r3, [%0]                       \n\t"
+            "cmp r2, r3                         \n\t"
+            "bne copyv_back4%=                  \n\t"
+            "add %0, %0, #4                     \n\t"
+            "sub %2, %2, #4                     \n\t"
+            "b copyv_words%=                    \n\t"
+            "copyv_back16%=:                    \n\t"
+            "sub %1, %1, #16                    \n\t"
+            "b copyv_end%=                      \n\t"
+            "copyv_back4%=:                     \n\t"
+            "sub %1, %1, #4                     \n\t"
+            "copyv_end%=:                       \n\t"
+            : "=r" (dst), "=r" (src), "=r" (remaining)
+            : "0" (dst), "1" (src), "2" (remaining)
+            : "r2", "r3", "r4", "r5", "r12", "cc", "memory"
+        );
+#else
+        while (remaining >= sizeof(uint32_t))
+        {
+            uint32_t word = 0u;
+
+            (void)memcpy(&word, src, sizeof(word));
+            *(volatile uint32_t *)dst = word;
+
+            if (*(volatile uint32_t *)dst != word)
+            {
+                break;
+            }
+
+            src += sizeof(uint32_t);
+            dst += sizeof(uint32_t);
+            remaining -= sizeof(uint32_t);
+        }
+#endif
+    }
+
+    while (remaining != 0u)
+    {
+        *dst = *src;
+
+        if (*dst != *src)
+        {
+            goto not_copied;
+        }
+
+        ++src;
+        ++dst;
+        --remaining;
+    }
+
+    if (first_bad != NULL)
+    {
+        *first_bad = size;
+    }
+
+    goto return_status;
+
+not_copied:
+    status_out = STRUCT_NOT_COPIED;
+
+    if (first_bad != NULL)
+    {
+        *first_bad = size - remaining;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_fillVerified
+ *  @package memory_operations
+ *
+ *  @brief   Fills a structure and reads every burst back right after storing it - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Same loop as MEM_copyVerified with the value replicated into the burst registers, so the fill and
+ *           the check of MEM_isFilled run in a single pass over the region.
+ *
+ *  @param   struct_ptr [out] : Pointer to the structure to be filled.
+ *  @param   size       [in]  : Size of the structure to be filled.
+ *  @param   value      [in]  : Value to be used to fill the structure.
+ *  @param   first_bad  [out] : Offset of the first byte that did not read back, or size on success; may be NULL.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED        : Structure filled and read back.
+ *              * STRUCT_NOT_FILLED    : A byte did not read back; see first_bad. Later bytes are not filled.
+ *              * FILL_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+
+MEM_struct_fill_t MEM_fillVerified(void *struct_ptr, size_t size, uint8_t value, size_t *first_bad)
+{
+    MEM_struct_fill_t status_out = STRUCT_FILLED;
+    volatile uint8_t *dst = (volatile uint8_t *)struct_ptr;
+    size_t remaining = size;
+    uint32_t pattern = (uint32_t)value * 0x01010101u;
+
+    if (struct_ptr == NULL)
+    {
+        status_out = FILL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    while ((remaining != 0u) && (((uintptr_t)dst & ARCH_WORD_MASK) != 0u))
+    {
+        *dst = value;
+
+        if (*dst != value)
+        {
+            goto not_filled;
+        }
+
+        ++dst;
+        --remaining;
+    }
+
+    /* Same rewind contract as MEM_copyVerified: a failing burst is left to the byte loop. */
+#if defined(__arm__)
+    asm volatile
+    (
+        "mov r2, %2                         \n\t"
+        "mov r3, %2                         \n\t"
+        "mov r4, %2                         \n\t"
+        "mov r5, %2                         \n\t"
+        "cmp %1, #16                        \n\t"
+        "blo fillv_words%=                  \n\t"
+        "fillv_burst%=:                     \n\t"
+        "stmia %0, {r2, r3, r4, r5}         \n\t"
+        "ldr r6, [%0]                       \n\t"
+        "ldr r12, [%0, #4]                  \n\t"
+#if defined(__ARM_FEATURE_DSP)
+        "usad8 r6, r6, %2                   \n\t"
+        "usada8 r6, r12, %2, r6             \n\t"
+        "ldr r12, [%0, #8]                  \n\t"
+        "usada8 r6, r12, %2, r6             \n\t"
+        "ldr r12, [%0, #12]                 \n\t"
+        "usada8 r6, r12, %2, r6             \n\t"
+        "cmp r6, #0                         \n\t"
+#else
+        "eor r6, r6, %2                     \n\t"
+        "eor r12, r12, %2                   \n\t"
+        "orr r6, r6, r12                    \n\t"
+        "ldr r12, [%0, #8]                  \n\t"
+        "eor r12, r12, %2                   \n\t"
+        "orr r6, r6, r12                    \n\t"
+        "ldr r12, [%0, #12]                 \n\t"
+        "eor r12, r12, %2                   \n\t"
+        "orrs r6, r6, r12                   \n\t"
+#endif
+        "bne fillv_end%=                    \n\t"
+        "add %0, %0, #16                    \n\t"
+        "sub %1, %1, #16                    \n\t"
+        "cmp %1, #16                        \n\t"
+        "bhs fillv_burst%=                  \n\t"
+        "fillv_words%=:                     \n\t"
+        "cmp %1, #4                         \n\t"
+        "blo fillv_end%=                    \n\t"
+        "str %2, [%0]                       \n\t"
+        "ldr r6, [%0]                       \n\t"
+        "cmp r6, %2                         \n\t"
+        "bne fillv_end%=                    \n\t"
+        "add %0, %0, #4                     \n\t"
+        "sub %1, %1, #4                     \n\t"
+        "b fillv_words%=                    \n\t"
+        "fillv_end%=:                       \n\t"
+        : "=r" (dst), "=r" (remaining)
+        : "r" (pattern), "0" (dst), "1" (remaining)
+        : "r2", "r3", "r4", "r5", "r6", "r12", "cc", "memory"
+    );
+#else
+    while (remaining >= sizeof(uint32_t))
+    {
+        *(volatile uint32_t *)dst = pattern;
+
+        if (*(volatile uint32_t *)dst != pattern)
+        {
+            break;
+        }
+
+        dst += sizeof(uint32_t);
+        remaining -= sizeof(uint32_t);
+    }
+#endif
+
+    while (remaining != 0u)
+    {
+        *dst = value;
+
+        if (*dst != value)
+        {
+            goto not_filled;
+        }
+
+        ++dst;
+        --remaining;
+    }
+
+    if (first_bad != NULL)
+    {
+        *first_bad = size;
+    }
+
+    goto return_status;
+
+not_filled:
+    status_out = STRUCT_NOT_FILLED;
+
+    if (first_bad != NULL)
+    {
+        *first_bad = size - remaining;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_findByte
+ *  @package memory_operations
+ *
+ *  @brief   Finds the first occurrence of a byte value (memchr equivalent) - ASSEMBLY: ARM (Thumb-2).
+ *
+ *  @details Scans a word at a time: with x = word ^ (value replicated), the expression
+ *           (x - 0x01010101) & ~x & 0x80808080 is non-zero exactly when some byte of x is zero, i.e. when the
+ *           word contains value. Only the matching word is then examined byte by byte.
+ *
+ *           With the Cortex-M4 DSP extension (__ARM_FEATURE_DSP) the zero test moves into the SIMD byte
+ *           lanes: UADD8 x, 0xFFFFFFFF sets the GE flag of every non-zero byte, and SEL turns the flags into a
+ *           byte mask. The mask of one word is the SEL fallback of the next, so a two-word LDM takes two EORs,
+ *           two UADD8/SEL pairs and a single test. The compare and fill-check loops only need to know whether
+ *           a whole burst matches, which USADA8 answers in one instruction per word, so they use that instead.
+ *
+ *  @param   buffer [in]  : Pointer to the buffer to search.
+ *  @param   size   [in]  : Size of the buffer in bytes.
+ *  @param   value  [in]  : Byte value to look for.
+ *  @param   offset [out] : Offset of the first match; may be NULL.
+ *
+ *  @return  MEM_struct_search_t - Returns the search status, which can be:
+ *              * PATTERN_FOUND        : Value found at *offset.
+ *              * PATTERN_NOT_FOUND    : Value not present.
+ *              * SEARCH_BAD_ADDRESS   : Error due to a null pointer.
+ **/
+
+MEM_struct_search_t MEM_findByte(const void *buffer, size_t size, uint8_t value, size_t *offset)
+{
+    MEM_struct_search_t status_out = PATTERN_NOT_FOUND;
+    const uint8_t *byte_ptr = (const uint8_t *)buffer;
+
+    if (buffer == NULL)
+    {
+        status_out = SEARCH_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    while ((size != 0u) && (((uintptr_t)byte_ptr & ARCH_WORD_MASK) != 0u))
+    {
+        if (*byte_ptr == value)
+        {
+            goto found;
+        }
+
+        ++byte_ptr;
+        --size;
+    }
+
+    /* Word scan: stops on the first word holding value, rewound so the byte loop below locates it. */
+#if defined(__arm__) && defined(__ARM_FEATURE_DSP)
+    asm volatile
+    (
+        "cmp %1, #8                         \n\t"
+        "blo findd_word%=                   \n\t"
+        "findd_pair%=:                      \n\t"
+        "ldmia %0!, {r2, r3}                \n\t"
+        "eor r2, r2, %2                     \n\t"
+        "eor r3, r3, %2                     \n\t"
+        "uadd8 r2, r2, %3                   \n\t"
+        "sel r2, %4, %3                     \n\t"
+        "uadd8 r3, r3, %3                   \n\t"
+        "sel r3, r2, %3                     \n\t"
+        "cmp r3, #0                         \n\t"
+        "bne findd_back8%=                  \n\t"
+        "sub %1, %1, #8                     \n\t"
+        "cmp %1, #8                         \n\t"
+        "bhs findd_pair%=                   \n\t"
+        "findd_word%=:                      \n\t"
+        "cmp %1, #4                         \n\t"
+        "blo findd_end%=                    \n\t"
+        "ldr r2, [%0], #4                   \n\t"
+        "eor r2, r2, %2                     \n\t"
+        "uadd8 r2, r2, %3                   \n\t"
+        "sel r2, %4, %3                     \n\t"
+        "cmp r2, #0                         \n\t"
+        "bne findd_back4%=                  \n\t"
+        "sub %1, %1, #4                     \n\t"
+        "b findd_end%=                      \n\t"
+        "findd_back8%=:                     \n\t"
+        "sub %0, %0, #4                     \n\t"
+        "findd_back4%=:                     \n\t"
+        "sub %0, %0, #4                     \n\t"
+        "findd_end%=:                       \n\t"
+        : "=r" (byte_ptr), "=r" (size)
+        : "r" ((uint32_t)value * 0x01010101u), "r" (0xFFFFFFFFu), "r" (0u), "0" (byte_ptr), "1" (size)
+        : "r2", "r3", "cc", "memory"
+    );
+#elif defined(__arm__)
+    asm volatile
+    (
+        "find_loop%=:                       \n\t"
+        "cmp %1, #4                         \n\t"
+        "blo find_end%=                     \n\t"
+        "ldr r2, [%0], #4                   \n\t"
+        "eor r2, r2, %2                     \n\t"
+        "sub r3, r2, #0x01010101            \n\t"
+        "bic r3, r3, r2                     \n\t"
+        "tst r3, #0x80808080                \n\t"
+        "bne find_back%=                    \n\t"
+        "sub %1, %1, #4                     \n\t"
+        "b find_loop%=                      \n\t"
+        "find_back%=:                       \n\t"
+        "sub %0, %0, #4                     \n\t"
+        "find_end%=:                        \n\t"
+        : "=r" (byte_ptr), "=r" (size)
+        : "r" ((uint32_t)value * 0x01010101u), "0" (byte_ptr), "1" (size)
+        : "r2", "r3", "cc", "memory"
+    );
+#else
+    {
+        const uintptr_t ones = (uintptr_t)(-1) / 0xFFu;
+        const uintptr_t pattern = ones * value;
+
+        while (size >= sizeof(uintptr_t))
+        {
+            uintptr_t word = 0u;
+
+            (void)memcpy(&word, byte_ptr, sizeof(word));
+            word ^= pattern;
+
+            if (((word - ones) & ~word & (ones << 7)) != 0u)
+            {
+                break;
+            }
+
+            byte_ptr += sizeof(uintptr_t);
+            size -= sizeof(uintptr_t);
+        }
+    }
+#endif
+
+    while (size != 0u)
+    {
+        if (*byte_ptr == value)
+        {
+            goto found;
+        }
+
+        ++byte_ptr;
+        --size;
+    }
+
+    goto return_status;
+
+found:
+    status_out = PATTERN_FOUND;
+
+    if (offset != NULL)
+    {
+        *offset = (size_t)(byte_ptr - (const uint8_t *)buffer);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_findPattern
+ *  @package memory_operations
+ *
+ *  @brief   Finds the first occurrence of a byte sequence (memmem equivalent).
+ *
+ *  @details Candidates are produced by MEM_findByte on the first pattern byte and rejected early unless the
+ *           byte at the pattern's last position also matches; only then are the inner bytes compared.
+ *
+ *  @param   buffer       [in]  : Pointer to the buffer to search.
+ *  @param   size         [in]  : Size of the buffer in bytes.
+ *  @param   pattern      [in]  : Pointer to the pattern.
+ *  @param   pattern_size [in]  : Size of the pattern in bytes.
+ *  @param   offset       [out] : Offset of the first match; may be NULL.
+ *
+ *  @return  MEM_struct_search_t - Returns the search status, which can be:
+ *              * PATTERN_FOUND        : Pattern found at *offset.
+ *              * PATTERN_NOT_FOUND    : Pattern not present.
+ *              * SEARCH_ERROR         : Pattern is empty.
+ *              * SEARCH_BAD_ADDRESS   : Error due to a null pointer.
+ **/
+
+MEM_struct_search_t MEM_findPattern(const void *buffer, size_t size, const void *pattern, size_t pattern_size,
+                                    size_t *offset)
+{
+    MEM_struct_search_t status_out = PATTERN_NOT_FOUND;
+    const uint8_t *haystack = (const uint8_t *)buffer;
+    const uint8_t *needle = (const uint8_t *)pattern;
+    size_t position = 0u;
+    size_t candidate = 0u;
+    size_t inner = 0u;
+
+    if (buffer == NULL || pattern == NULL)
+    {
+        status_out = SEARCH_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if (pattern_size == 0u)
+    {
+        status_out = SEARCH_ERROR;
+        goto return_status;
+    }
+
+    while (size >= pattern_size && position <= size - pattern_size)
+    {
+        if (MEM_findByte(haystack + position, size - position - pattern_size + 1u, needle[0], &candidate)
+            != PATTERN_FOUND)
+        {
+            break;
+        }
+
+        position += candidate;
+
+        if (haystack[position + pattern_size - 1u] == needle[pattern_size - 1u])
+        {
+            for (inner = 1u; inner + 1u < pattern_size; ++inner)
+            {
+                if (haystack[position + inner] != needle[inner])
+                {
+                    break;
+                }
+            }
+
+            if (inner + 1u >= pattern_size)
+            {
+                status_out = PATTERN_FOUND;
+
+                if (offset != NULL)
+                {
+                    *offset = position;
+                }
+
+                goto return_status;
+            }
+        }
+
+        ++position;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      copySwapElements
+ *  @package memory_operations
+ *
+ *  @brief   Copies count elements of width bytes, reversing the byte order of each - ASSEMBLY: ARM (REV/REV16).
+ *
+ *  @details ARM: one load, one REV/REV16 and one store per element when both buffers are aligned to the element
+ *           (a 64-bit element is two reversed words stored in swapped order). x86 with SSSE3: 16-byte blocks
+ *           through a single PSHUFB. Misaligned buffers and the remainder take a byte loop that stages each
+ *           element, so source may equal destine.
+ **/
+static void copySwapElements(const uint8_t *source, uint8_t *destine, size_t count, size_t width)
+{
+    size_t done = 0u;
+    size_t index = 0u;
+    uint8_t element[8];
+
+#if defined(__arm__)
+    const uintptr_t align_mask = (width == 2u) ? (uintptr_t)1u : ARCH_WORD_MASK;
+
+    if ((count != 0u) && ((((uintptr_t)source | (uintptr_t)destine) & align_mask) == 0u))
+    {
+        const uint8_t *src = source;
+        uint8_t *dst = destine;
+        size_t remaining = count;
+
+        if (width == 2u)
+        {
+            asm volatile
+            (
+                "swap16_loop%=:                     \n\t"
+                "ldrh r2, [%1], #2                  \n\t"
+                "rev16 r2, r2                       \n\t"
+                "strh r2, [%0], #2                  \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne swap16_loop%=                  \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining)
+                : "r2", "cc", "memory"
+            );
+        }
+        else if (width == 4u)
+        {
+            asm volatile
+            (
+                "swap32_loop%=:                     \n\t"
+                "ldr r2, [%1], #4                   \n\t"
+                "rev r2, r2                         \n\t"
+                "str r2, [%0], #4                   \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne swap32_loop%=                  \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining)
+                : "r2", "cc", "memory"
+            );
+        }
+        else
+        {
+            asm volatile
+            (
+                "swap64_loop%=:                     \n\t"
+                "ldmia %1!, {r2, r3}                \n\t"
+                "rev r2, r2                         \n\t"
+                "rev r3, r3                         \n\t"
+                "str r3, [%0], #4                   \n\t"
+                "str r2, [%0], #4                   \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne swap64_loop%=                  \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining)
+                : "r2", "r3", "cc", "memory"
+            );
+        }
+
+        done = count;
+    }
+#elif defined(__SSSE3__)
+    {
+        static const uint8_t shuffle[3][16] =
+        {
+            { 1u, 0u, 3u, 2u, 5u, 4u, 7u, 6u, 9u, 8u, 11u, 10u, 13u, 12u, 15u, 14u },
+            { 3u, 2u, 1u, 0u, 7u, 6u, 5u, 4u, 11u, 10u, 9u, 8u, 15u, 14u, 13u, 12u },
+            { 7u, 6u, 5u, 4u, 3u, 2u, 1u, 0u, 15u, 14u, 13u, 12u, 11u, 10u, 9u, 8u }
+        };
+        const __m128i mask = _mm_loadu_si128((const __m128i *)(const void *)
+                                             shuffle[(width == 2u) ? 0u : ((width == 4u) ? 1u : 2u)]);
+        size_t blocks = (count * width) / 16u;
+
+        for (index = 0u; index < blocks; ++index)
+        {
+            __m128i block = _mm_loadu_si128((const __m128i *)(const void *)(source + (index * 16u)));
+
+            _mm_storeu_si128((__m128i *)(void *)(destine + (index * 16u)), _mm_shuffle_epi8(block, mask));
+        }
+
+        done = (blocks * 16u) / width;
+    }
+#endif
+
+    for (; done < count; ++done)
+    {
+        for (index = 0u; index < width; ++index)
+        {
+            element[index] = source[(done * width) + (width - 1u - index)];
+        }
+
+        for (index = 0u; index < width; ++index)
+        {
+            destine[(done * width) + index] = element[index];
+        }
+    }
+}
+
+/**
+ *  @fn      copySwap
+ *  @package memory_operations
+ *
+ *  @brief   Shared validation for the MEM_copySwapNN entry points.
+ **/
+static MEM_struct_copy_t copySwap(const void *source, void *destine, size_t size, size_t width)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+
+    if (source == NULL || destine == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((size % width) != 0u)
+    {
+        status_out = STRUCT_COPY_ERROR;
+        goto return_status;
+    }
+
+    copySwapElements((const uint8_t *)source, (uint8_t *)destine, size / width, width);
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_copySwap16
+ *  @package memory_operations
+ *
+ *  @brief   Copies an array of 16-bit values, swapping the byte order of each - ASSEMBLY: ARM (REV16).
+ *
+ *  @param   source  [in]  : Pointer to the source array.
+ *  @param   destine [out] : Pointer to the destination array; may equal source.
+ *  @param   size    [in]  : Size of the array in bytes, a multiple of 2.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Array copied and swapped.
+ *              * STRUCT_COPY_ERROR     : Size is not a multiple of the element size.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copySwap16(const void *source, void *destine, size_t size)
+{
+    return copySwap(source, destine, size, sizeof(uint16_t));
+}
+
+/**
+ *  @fn      MEM_copySwap32
+ *  @package memory_operations
+ *
+ *  @brief   Copies an array of 32-bit values, swapping the byte order of each - ASSEMBLY: ARM (REV).
+ *
+ *  @param   source  [in]  : Pointer to the source array.
+ *  @param   destine [out] : Pointer to the destination array; may equal source.
+ *  @param   size    [in]  : Size of the array in bytes, a multiple of 4.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Array copied and swapped.
+ *              * STRUCT_COPY_ERROR     : Size is not a multiple of the element size.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copySwap32(const void *source, void *destine, size_t size)
+{
+    return copySwap(source, destine, size, sizeof(uint32_t));
+}
+
+/**
+ *  @fn      MEM_copySwap64
+ *  @package memory_operations
+ *
+ *  @brief   Copies an array of 64-bit values, swapping the byte order of each - ASSEMBLY: ARM (REV).
+ *
+ *  @param   source  [in]  : Pointer to the source array.
+ *  @param   destine [out] : Pointer to the destination array; may equal source.
+ *  @param   size    [in]  : Size of the array in bytes, a multiple of 8.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Array copied and swapped.
+ *              * STRUCT_COPY_ERROR     : Size is not a multiple of the element size.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copySwap64(const void *source, void *destine, size_t size)
+{
+    return copySwap(source, destine, size, sizeof(uint64_t));
+}
+
+/**
+ *  @fn      MEM_copySwapFields
+ *  @package memory_operations
+ *
+ *  @brief   Copies a structure in one pass, byte-swapping only its multi-byte fields.
+ *
+ *  @details Walks the field list in order: the bytes between fields are burst-copied unchanged and each field
+ *           goes through the swap kernel matching its size (2, 4 or 8). Fields of any other size are copied
+ *           unchanged. Fields must be sorted by offset and must not overlap.
+ *
+ *  @param   source  [in]  : Pointer to the source structure.
+ *  @param   destine [out] : Pointer to the destination structure; may equal source.
+ *  @param   size    [in]  : Size of the structure in bytes.
+ *  @param   fields  [in]  : Fields to swap, sorted by offset (see MEM_FIELD).
+ *  @param   count   [in]  : Number of entries in fields.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Structure copied and fields swapped.
+ *              * STRUCT_COPY_ERROR     : Fields unsorted, overlapping or outside the structure.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copySwapFields(const void *source, void *destine, size_t size,
+                                     const MEM_field_t *fields, size_t count)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    const uint8_t *src = (const uint8_t *)source;
+    uint8_t *dst = (uint8_t *)destine;
+    size_t position = 0u;
+    size_t index = 0u;
+
+    if (source == NULL || destine == NULL || (fields == NULL && count != 0u))
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    for (index = 0u; index < count; ++index)
+    {
+        if (fields[index].offset < position || fields[index].offset > size
+            || fields[index].size > size - fields[index].offset)
+        {
+            status_out = STRUCT_COPY_ERROR;
+            goto return_status;
+        }
+
+        position = fields[index].offset + fields[index].size;
+    }
+
+    position = 0u;
+
+    for (index = 0u; index <= count; ++index)
+    {
+        size_t gap_end = (index < count) ? fields[index].offset : size;
+        size_t width = (index < count) ? fields[index].size : 0u;
+
+        if (src != dst)
+        {
+            archBurstCopy(dst + position, src + position, gap_end - position);
+        }
+
+        if (width == 2u || width == 4u || width == 8u)
+        {
+            copySwapElements(src + gap_end, dst + gap_end, 1u, width);
+        }
+        else if (src != dst)
+        {
+            archBurstCopy(dst + gap_end, src + gap_end, width);
+        }
+
+        position = gap_end + width;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_copy2D
+ *  @package memory_operations
+ *
+ *  @brief   Copies a rectangle of rows bytes-wide rows between two buffers with independent strides.
+ *
+ *  @details The arguments are checked and the statistics/trace hooks run once per rectangle, not once per
+ *           row. When both strides equal the width the rows are adjacent and copyKernel moves the whole
+ *           rectangle in one pass, so the bursts run across row boundaries. Otherwise copyKernel is inlined
+ *           into the row loop: each row costs only the kernel's own head/tail handling, and the burst
+ *           registers stay allocated for the whole loop. When the strides keep both pointers on the same word
+ *           offset (e.g. widths and strides that are multiples of 4), every row takes the burst path.
+ *
+ *  @param   source         [in]  : Pointer to the first byte of the source rectangle.
+ *  @param   source_stride  [in]  : Bytes from the start of one source row to the next.
+ *  @param   destine        [out] : Pointer to the first byte of the destination rectangle.
+ *  @param   destine_stride [in]  : Bytes from the start of one destination row to the next.
+ *  @param   width          [in]  : Bytes per row.
+ *  @param   rows           [in]  : Number of rows.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Rectangle copied (also for an empty rectangle).
+ *              * STRUCT_COPY_ERROR     : A stride is smaller than the width, so rows would overlap.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copy2D(const void *source, size_t source_stride, void *destine, size_t destine_stride,
+                             size_t width, size_t rows)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    const uint8_t *src = (const uint8_t *)source;
+    uint8_t *dst = (uint8_t *)destine;
+    size_t row = 0u;
+
+    if (source == NULL || destine == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((rows > 1u) && ((source_stride < width) || (destine_stride < width)))
+    {
+        status_out = STRUCT_COPY_ERROR;
+        goto return_status;
+    }
+
+    if ((width == 0u) || (rows == 0u))
+    {
+        goto return_status;
+    }
+
+    {
+        MEM_TRACE_RECORD(MEM_STATS_COPY, source, destine, width * rows);
+        MEM_STATS_BEGIN();
+
+        if ((source_stride == width) && (destine_stride == width) && (rows <= (SIZE_MAX / width)))
+        {
+            copyKernel(dst, src, width * rows);
+        }
+        else
+        {
+            for (row = 0u; row < rows; ++row)
+            {
+                copyKernel(dst, src, width);
+                src += source_stride;
+                dst += destine_stride;
+            }
+        }
+
+        MEM_STATS_END(MEM_STATS_COPY, source, destine, width * rows);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_fill2D
+ *  @package memory_operations
+ *
+ *  @brief   Fills a rectangle of rows bytes-wide rows with a value.
+ *
+ *  @details Checks and hooks run once per rectangle. A stride equal to the width fills the rectangle in one
+ *           fillKernel pass; otherwise fillKernel is inlined into the row loop, as in MEM_copy2D.
+ *
+ *  @param   struct_ptr [out] : Pointer to the first byte of the rectangle.
+ *  @param   stride     [in]  : Bytes from the start of one row to the next.
+ *  @param   width      [in]  : Bytes per row.
+ *  @param   rows       [in]  : Number of rows.
+ *  @param   value      [in]  : Value to be used to fill the rectangle.
+ *
+ *  @return  MEM_struct_fill_t - Returns the fill status, which can be:
+ *              * STRUCT_FILLED         : Rectangle filled (also for an empty rectangle).
+ *              * STRUCT_FILL_ERROR     : The stride is smaller than the width, so rows would overlap.
+ *              * FILL_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_fill_t MEM_fill2D(void *struct_ptr, size_t stride, size_t width, size_t rows, uint8_t value)
+{
+    MEM_struct_fill_t status_out = STRUCT_FILLED;
+    uint8_t *line = (uint8_t *)struct_ptr;
+    size_t row = 0u;
+
+    if (struct_ptr == NULL)
+    {
+        status_out = FILL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((rows > 1u) && (stride < width))
+    {
+        status_out = STRUCT_FILL_ERROR;
+        goto return_status;
+    }
+
+    if ((width == 0u) || (rows == 0u))
+    {
+        goto return_status;
+    }
+
+    {
+        MEM_TRACE_RECORD(MEM_STATS_FILL, struct_ptr, struct_ptr, width * rows);
+        MEM_STATS_BEGIN();
+
+        if ((stride == width) && (rows <= (SIZE_MAX / width)))
+        {
+            fillKernel(line, width * rows, value);
+        }
+        else
+        {
+            for (row = 0u; row < rows; ++row)
+            {
+                fillKernel(line, width, value);
+                line += stride;
+            }
+        }
+
+        MEM_STATS_END(MEM_STATS_FILL, struct_ptr, struct_ptr, width * rows);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      copyElement
+ *  @package memory_operations
+ *
+ *  @brief   Copies one element of width bytes; the common sample sizes stay free of a call.
+ **/
+static inline void copyElement(uint8_t *destine, const uint8_t *source, size_t width)
+{
+    switch (width)
+    {
+        case 1u:
+            destine[0] = source[0];
+            break;
+        case 2u:
+            destine[0] = source[0];
+            destine[1] = source[1];
+            break;
+        case 4u:
+            destine[0] = source[0];
+            destine[1] = source[1];
+            destine[2] = source[2];
+            destine[3] = source[3];
+            break;
+        default:
+            archBurstCopy(destine, source, width);
+            break;
+    }
+}
+
+/**
+ *  @fn      gatherElements
+ *  @package memory_operations
+ *
+ *  @brief   Packs count elements of width bytes read stride bytes apart - ASSEMBLY: ARM.
+ *
+ *  @details ARM: for 8, 16 and 32-bit elements with destine word aligned and the strided side aligned to the
+ *           element, each iteration loads one word's worth of elements (four bytes, two halfwords or two
+ *           words), merges them with shifted ORRs and writes them with a single STR/STM. The remainder, and
+ *           every other size or alignment, takes the element loop.
+ **/
+static void gatherElements(const uint8_t *source, uint8_t *destine, size_t count, size_t stride, size_t width)
+{
+    size_t done = 0u;
+
+#if defined(__arm__)
+    const uintptr_t align_mask = (width == 1u) ? (uintptr_t)0u : (uintptr_t)(width - 1u);
+    const size_t per_loop = (width == 4u) ? 2u : (4u / width);
+
+    if (((width == 1u) || (width == 2u) || (width == 4u)) && (count >= per_loop)
+        && (((uintptr_t)destine & ARCH_WORD_MASK) == 0u)
+        && ((((uintptr_t)source | (uintptr_t)stride) & align_mask) == 0u))
+    {
+        const uint8_t *src = source;
+        uint8_t *dst = destine;
+        size_t remaining = count / per_loop;
+
+        if (width == 1u)
+        {
+            asm volatile
+            (
+                "gather8_loop%=:                    \n\t"
+                "ldrb r2, [%1]                      \n\t"
+                "add %1, %1, %3                     \n\t"
+                "ldrb r3, [%1]                      \n\t"
+                "add %1, %1, %3                     \n\t"
+                "orr r2, r2, r3, lsl #8             \n\t"
+                "ldrb r3, [%1]                      \n\t"
+                "add %1, %1, %3                     \n\t"
+                "orr r2, r2, r3, lsl #16            \n\t"
+                "ldrb r3, [%1]                      \n\t"
+                "add %1, %1, %3                     \n\t"
+                "orr r2, r2, r3, lsl #24            \n\t"
+                "str r2, [%0], #4                   \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne gather8_loop%=                 \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining), "r" (stride)
+                : "r2", "r3", "cc", "memory"
+            );
+        }
+        else if (width == 2u)
+        {
+            asm volatile
+            (
+                "gather16_loop%=:                   \n\t"
+                "ldrh r2, [%1]                      \n\t"
+                "add %1, %1, %3                     \n\t"
+                "ldrh r3, [%1]                      \n\t"
+                "add %1, %1, %3                     \n\t"
+                "orr r2, r2, r3, lsl #16            \n\t"
+                "str r2, [%0], #4                   \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne gather16_loop%=                \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining), "r" (stride)
+                : "r2", "r3", "cc", "memory"
+            );
+        }
+        else
+        {
+            asm volatile
+            (
+                "gather32_loop%=:                   \n\t"
+                "ldr r2, [%1]                       \n\t"
+                "add %1, %1, %3                     \n\t"
+                "ldr r3, [%1]                       \n\t"
+                "add %1, %1, %3                     \n\t"
+                "stmia %0!, {r2, r3}                \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne gather32_loop%=                \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining), "r" (stride)
+                : "r2", "r3", "cc", "memory"
+            );
+        }
+
+        done = (count / per_loop) * per_loop;
+    }
+#endif
+
+    for (; done < count; ++done)
+    {
+        copyElement(destine + (done * width), source + (done * stride), width);
+    }
+}
+
+/**
+ *  @fn      scatterElements
+ *  @package memory_operations
+ *
+ *  @brief   Spreads count packed elements of width bytes stride bytes apart - ASSEMBLY: ARM.
+ *
+ *  @details ARM: the inverse of gatherElements under the same alignment rules. Each iteration loads one word
+ *           (two for 32-bit elements) and stores its elements one by one, shifting the next into the low bits.
+ **/
+static void scatterElements(const uint8_t *source, uint8_t *destine, size_t count, size_t stride, size_t width)
+{
+    size_t done = 0u;
+
+#if defined(__arm__)
+    const uintptr_t align_mask = (width == 1u) ? (uintptr_t)0u : (uintptr_t)(width - 1u);
+    const size_t per_loop = (width == 4u) ? 2u : (4u / width);
+
+    if (((width == 1u) || (width == 2u) || (width == 4u)) && (count >= per_loop)
+        && (((uintptr_t)source & ARCH_WORD_MASK) == 0u)
+        && ((((uintptr_t)destine | (uintptr_t)stride) & align_mask) == 0u))
+    {
+        const uint8_t *src = source;
+        uint8_t *dst = destine;
+        size_t remaining = count / per_loop;
+
+        if (width == 1u)
+        {
+            asm volatile
+            (
+                "scatter8_loop%=:                   \n\t"
+                "ldr r2, [%1], #4                   \n\t"
+                "strb r2, [%0]                      \n\t"
+                "add %0, %0, %3                     \n\t"
+                "lsr r2, r2, #8                     \n\t"
+                "strb r2, [%0]                      \n\t"
+                "add %0, %0, %3                     \n\t"
+                "lsr r2, r2, #8                     \n\t"
+                "strb r2, [%0]                      \n\t"
+                "add %0, %0, %3                     \n\t"
+                "lsr r2, r2, #8                     \n\t"
+                "strb r2, [%0]                      \n\t"
+                "add %0, %0, %3                     \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne scatter8_loop%=                \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining), "r" (stride)
+                : "r2", "cc", "memory"
+            );
+        }
+        else if (width == 2u)
+        {
+            asm volatile
+            (
+                "scatter16_loop%=:                  \n\t"
+                "ldr r2, [%1], #4                   \n\t"
+                "strh r2, [%0]                      \n\t"
+                "add %0, %0, %3                     \n\t"
+                "lsr r2, r2, #16                    \n\t"
+                "strh r2, [%0]                      \n\t"
+                "add %0, %0, %3                     \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne scatter16_loop%=               \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining), "r" (stride)
+                : "r2", "cc", "memory"
+            );
+        }
+        else
+        {
+            asm volatile
+            (
+                "scatter32_loop%=:                  \n\t"
+                "ldmia %1!, {r2, r3}                \n\t"
+                "str r2, [%0]                       \n\t"
+                "add %0, %0, %3                     \n\t"
+                "str r3, [%0]                       \n\t"
+                "add %0, %0, %3                     \n\t"
+                "subs %2, %2, #1                    \n\t"
+                "bne scatter32_loop%=               \n\t"
+                : "=r" (dst), "=r" (src), "=r" (remaining)
+                : "0" (dst), "1" (src), "2" (remaining), "r" (stride)
+                : "r2", "r3", "cc", "memory"
+            );
+        }
+
+        done = (count / per_loop) * per_loop;
+    }
+#endif
+
+    for (; done < count; ++done)
+    {
+        copyElement(destine + (done * stride), source + (done * width), width);
+    }
+}
+
+/**
+ *  @fn      deinterleaveStereo
+ *  @package memory_operations
+ *
+ *  @brief   Splits leading two-channel frames into two planes - ASSEMBLY: ARM (PKHBT/PKHTB).
+ *
+ *  @details ARM with the DSP extension, 16-bit samples, all buffers word aligned: two frames per iteration,
+ *           one LDM of L0R0 L1R1, then PKHBT builds L0L1 and PKHTB builds R0R1. x86 with SSSE3: 16-byte blocks
+ *           through a single PSHUFB that moves the left samples to the low half and the right samples to the
+ *           high half.
+ *
+ *  @return  size_t - Frames done; the caller gathers the rest.
+ **/
+static size_t deinterleaveStereo(const uint8_t *source, uint8_t *left, uint8_t *right, size_t frames, size_t width)
+{
+    size_t done = 0u;
+
+#if defined(__arm__) && defined(__ARM_FEATURE_DSP)
+    if ((width == 2u) && (frames >= 2u)
+        && ((((uintptr_t)source | (uintptr_t)left | (uintptr_t)right) & ARCH_WORD_MASK) == 0u))
+    {
+        const uint8_t *src = source;
+        uint8_t *dst_l = left;
+        uint8_t *dst_r = right;
+        size_t remaining = frames / 2u;
+
+        asm volatile
+        (
+            "deint16_loop%=:                        \n\t"
+            "ldmia %2!, {r2, r3}                    \n\t"
+            "pkhbt r4, r2, r3, lsl #16              \n\t"
+            "pkhtb r5, r3, r2, asr #16              \n\t"
+            "str r4, [%0], #4                       \n\t"
+            "str r5, [%1], #4                       \n\t"
+            "subs %3, %3, #1                        \n\t"
+            "bne deint16_loop%=                     \n\t"
+            : "=r" (dst_l), "=r" (dst_r), "=r" (src), "=r" (remaining)
+            : "0" (dst_l), "1" (dst_r), "2" (src), "3" (remaining)
+            : "r2", "r3", "r4", "r5", "cc", "memory"
+        );
+
+        done = (frames / 2u) * 2u;
+    }
+#elif !defined(__arm__) && defined(__SSSE3__)
+    {
+        static const uint8_t shuffle[3][16] =
+        {
+            { 0u, 2u, 4u, 6u, 8u, 10u, 12u, 14u, 1u, 3u, 5u, 7u, 9u, 11u, 13u, 15u },
+            { 0u, 1u, 4u, 5u, 8u, 9u, 12u, 13u, 2u, 3u, 6u, 7u, 10u, 11u, 14u, 15u },
+            { 0u, 1u, 2u, 3u, 8u, 9u, 10u, 11u, 4u, 5u, 6u, 7u, 12u, 13u, 14u, 15u }
+        };
+        const __m128i mask = _mm_loadu_si128((const __m128i *)(const void *)
+                                             shuffle[(width == 1u) ? 0u : ((width == 2u) ? 1u : 2u)]);
+        const size_t per_block = 8u / width;
+        const size_t blocks = frames / per_block;
+        size_t index = 0u;
+
+        for (index = 0u; index < blocks; ++index)
+        {
+            __m128i block = _mm_loadu_si128((const __m128i *)(const void *)(source + (index * 16u)));
+
+            block = _mm_shuffle_epi8(block, mask);
+            _mm_storel_epi64((__m128i *)(void *)(left + (index * 8u)), block);
+            _mm_storel_epi64((__m128i *)(void *)(right + (index * 8u)), _mm_srli_si128(block, 8));
+        }
+
+        done = blocks * per_block;
+    }
+#else
+    (void)source;
+    (void)left;
+    (void)right;
+    (void)frames;
+    (void)width;
+#endif
+
+    return done;
+}
+
+/**
+ *  @fn      interleaveStereo
+ *  @package memory_operations
+ *
+ *  @brief   Merges leading samples of two planes into two-channel frames - ASSEMBLY: ARM (PKHBT/PKHTB).
+ *
+ *  @details ARM with the DSP extension, 16-bit samples, all buffers word aligned: one word from each plane
+ *           per iteration, PKHBT builds L0R0, PKHTB builds L1R1, one STM writes both frames. x86 with SSE2:
+ *           eight bytes from each plane merged by one PUNPCKL of the sample size.
+ *
+ *  @return  size_t - Frames done; the caller scatters the rest.
+ **/
+static size_t interleaveStereo(const uint8_t *left, const uint8_t *right, uint8_t *destine, size_t frames,
+                               size_t width)
+{
+    size_t done = 0u;
+
+#if defined(__arm__) && defined(__ARM_FEATURE_DSP)
+    if ((width == 2u) && (frames >= 2u)
+        && ((((uintptr_t)destine | (uintptr_t)left | (uintptr_t)right) & ARCH_WORD_MASK) == 0u))
+    {
+        const uint8_t *src_l = left;
+        const uint8_t *src_r = right;
+        uint8_t *dst = destine;
+        size_t remaining = frames / 2u;
+
+        asm volatile
+        (
+            "int16_loop%=:                          \n\t"
+            "ldr r2, [%1], #4                       \n\t"
+            "ldr r3, [%2], #4                       \n\t"
+            "pkhbt r4, r2, r3, lsl #16              \n\t"
+            "pkhtb r5, r3, r2, asr #16              \n\t"
+            "stmia %0!, {r4, r5}                    \n\t"
+            "subs %3, %3, #1                        \n\t"
+            "bne int16_loop%=                       \n\t"
+            : "=r" (dst), "=r" (src_l), "=r" (src_r), "=r" (remaining)
+            : "0" (dst), "1" (src_l), "2" (src_r), "3" (remaining)
+            : "r2", "r3", "r4", "r5", "cc", "memory"
+        );
+
+        done = (frames / 2u) * 2u;
+    }
+#elif !defined(__arm__) && defined(__SSE2__)
+    {
+        const size_t per_block = 8u / width;
+        const size_t blocks = frames / per_block;
+        size_t index = 0u;
+
+        for (index = 0u; index < blocks; ++index)
+        {
+            const __m128i block_l = _mm_loadl_epi64((const __m128i *)(const void *)(left + (index * 8u)));
+            const __m128i block_r = _mm_loadl_epi64((const __m128i *)(const void *)(right + (index * 8u)));
+            __m128i block;
+
+            if (width == 1u)
+            {
+                block = _mm_unpacklo_epi8(block_l, block_r);
+            }
+            else if (width == 2u)
+            {
+                block = _mm_unpacklo_epi16(block_l, block_r);
+            }
+            else
+            {
+                block = _mm_unpacklo_epi32(block_l, block_r);
+            }
+
+            _mm_storeu_si128((__m128i *)(void *)(destine + (index * 16u)), block);
+        }
+
+        done = blocks * per_block;
+    }
+#else
+    (void)left;
+    (void)right;
+    (void)destine;
+    (void)frames;
+    (void)width;
+#endif
+
+    return done;
+}
+
+/**
+ *  @fn      fieldCheck
+ *  @package memory_operations
+ *
+ *  @brief   Shared validation for MEM_gatherField and MEM_scatterField.
+ **/
+static MEM_struct_copy_t fieldCheck(const void *source, const void *destine, size_t stride, size_t field_offset,
+                                    size_t field_size)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+
+    if (source == NULL || destine == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((field_size == 0u) || (field_offset > stride) || (field_size > (stride - field_offset)))
+    {
+        status_out = STRUCT_COPY_ERROR;
+        goto return_status;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      channelCheck
+ *  @package memory_operations
+ *
+ *  @brief   Shared validation for MEM_deinterleave and MEM_interleave.
+ **/
+static MEM_struct_copy_t channelCheck(const void *source, const void *destine, size_t frames, size_t channels,
+                                      size_t sample_size)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+
+    if (source == NULL || destine == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((channels == 0u) || ((sample_size != 1u) && (sample_size != 2u) && (sample_size != 4u))
+        || (channels > (SIZE_MAX / sample_size)) || (frames > (SIZE_MAX / (channels * sample_size))))
+    {
+        status_out = STRUCT_COPY_ERROR;
+        goto return_status;
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_gatherField
+ *  @package memory_operations
+ *
+ *  @brief   Packs one field of every structure of an array into a contiguous column - ASSEMBLY: ARM.
+ *
+ *  @details 8, 16 and 32-bit fields take the word-merging ARM loop of gatherElements when the column is word
+ *           aligned and the field is aligned to its size in every structure; other fields are copied one at a
+ *           time.
+ *
+ *  @param   source       [in]  : Pointer to the first structure of the array.
+ *  @param   destine      [out] : Pointer to the column, count * field_size bytes; must not overlap source.
+ *  @param   count        [in]  : Number of structures.
+ *  @param   stride       [in]  : Bytes from one structure to the next, usually sizeof the structure.
+ *  @param   field_offset [in]  : Offset of the field inside a structure (see offsetof).
+ *  @param   field_size   [in]  : Size of the field in bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Column written (also for count 0).
+ *              * STRUCT_COPY_ERROR     : Empty field, or field not inside the stride.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_gatherField(const void *source, void *destine, size_t count, size_t stride,
+                                  size_t field_offset, size_t field_size)
+{
+    MEM_struct_copy_t status_out = fieldCheck(source, destine, stride, field_offset, field_size);
+
+    if (status_out == STRUCT_COPIED)
+    {
+        gatherElements((const uint8_t *)source + field_offset, (uint8_t *)destine, count, stride, field_size);
+    }
+
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_scatterField
+ *  @package memory_operations
+ *
+ *  @brief   Writes a contiguous column into one field of every structure of an array - ASSEMBLY: ARM.
+ *
+ *  @details The inverse of MEM_gatherField, under the same alignment rules. The other bytes of the
+ *           structures are left untouched.
+ *
+ *  @param   source       [in]  : Pointer to the column, count * field_size bytes.
+ *  @param   destine      [out] : Pointer to the first structure of the array; must not overlap source.
+ *  @param   count        [in]  : Number of structures.
+ *  @param   stride       [in]  : Bytes from one structure to the next, usually sizeof the structure.
+ *  @param   field_offset [in]  : Offset of the field inside a structure (see offsetof).
+ *  @param   field_size   [in]  : Size of the field in bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Fields written (also for count 0).
+ *              * STRUCT_COPY_ERROR     : Empty field, or field not inside the stride.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_scatterField(const void *source, void *destine, size_t count, size_t stride,
+                                   size_t field_offset, size_t field_size)
+{
+    MEM_struct_copy_t status_out = fieldCheck(source, destine, stride, field_offset, field_size);
+
+    if (status_out == STRUCT_COPIED)
+    {
+        scatterElements((const uint8_t *)source, (uint8_t *)destine + field_offset, count, stride, field_size);
+    }
+
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_deinterleave
+ *  @package memory_operations
+ *
+ *  @brief   Splits interleaved multi-channel samples into one plane per channel - ASSEMBLY: ARM (PKHBT).
+ *
+ *  @details Two channels go through deinterleaveStereo first (PKHBT/PKHTB on a Cortex-M4 for 16-bit samples,
+ *           PSHUFB on x86 with SSSE3). Every other channel count, and whatever the stereo kernel leaves, is
+ *           gathered channel by channel with a stride of one frame. A single channel is a plain copy.
+ *
+ *  @param   source      [in]  : Pointer to the interleaved frames, frames * channels * sample_size bytes.
+ *  @param   destine     [out] : Pointer to the planes; channel c starts at c * frames * sample_size. Must not
+ *                               overlap source.
+ *  @param   frames      [in]  : Number of frames (samples per channel).
+ *  @param   channels    [in]  : Number of channels per frame.
+ *  @param   sample_size [in]  : Size of one sample: 1, 2 or 4 bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Planes written (also for frames 0).
+ *              * STRUCT_COPY_ERROR     : No channel, unsupported sample size, or total size overflows.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_deinterleave(const void *source, void *destine, size_t frames, size_t channels,
+                                   size_t sample_size)
+{
+    MEM_struct_copy_t status_out = channelCheck(source, destine, frames, channels, sample_size);
+    const uint8_t *src = (const uint8_t *)source;
+    uint8_t *dst = (uint8_t *)destine;
+    const size_t plane = frames * sample_size;
+    const size_t frame = channels * sample_size;
+    size_t done = 0u;
+    size_t channel = 0u;
+
+    if (status_out != STRUCT_COPIED)
+    {
+        goto return_status;
+    }
+
+    if (channels == 1u)
+    {
+        archBurstCopy(dst, src, plane);
+        goto return_status;
+    }
+
+    if (channels == 2u)
+    {
+        done = deinterleaveStereo(src, dst, dst + plane, frames, sample_size);
+    }
+
+    for (channel = 0u; channel < channels; ++channel)
+    {
+        gatherElements(src + (done * frame) + (channel * sample_size),
+                       dst + (channel * plane) + (done * sample_size), frames - done, frame, sample_size);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_interleave
+ *  @package memory_operations
+ *
+ *  @brief   Merges one plane per channel into interleaved multi-channel samples - ASSEMBLY: ARM (PKHBT).
+ *
+ *  @details The inverse of MEM_deinterleave: two channels go through interleaveStereo first (PKHBT/PKHTB on a
+ *           Cortex-M4 for 16-bit samples, PUNPCKL on x86 with SSE2), and every plane is otherwise scattered
+ *           with a stride of one frame.
+ *
+ *  @param   source      [in]  : Pointer to the planes; channel c starts at c * frames * sample_size.
+ *  @param   destine     [out] : Pointer to the interleaved frames, frames * channels * sample_size bytes. Must
+ *                               not overlap source.
+ *  @param   frames      [in]  : Number of frames (samples per channel).
+ *  @param   channels    [in]  : Number of channels per frame.
+ *  @param   sample_size [in]  : Size of one sample: 1, 2 or 4 bytes.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Frames written (also for frames 0).
+ *              * STRUCT_COPY_ERROR     : No channel, unsupported sample size, or total size overflows.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_interleave(const void *source, void *destine, size_t frames, size_t channels,
+                                 size_t sample_size)
+{
+    MEM_struct_copy_t status_out = channelCheck(source, destine, frames, channels, sample_size);
+    const uint8_t *src = (const uint8_t *)source;
+    uint8_t *dst = (uint8_t *)destine;
+    const size_t plane = frames * sample_size;
+    const size_t frame = channels * sample_size;
+    size_t done = 0u;
+    size_t channel = 0u;
+
+    if (status_out != STRUCT_COPIED)
+    {
+        goto return_status;
+    }
+
+    if (channels == 1u)
+    {
+        archBurstCopy(dst, src, plane);
+        goto return_status;
+    }
+
+    if (channels == 2u)
+    {
+        done = interleaveStereo(src, src + plane, dst, frames, sample_size);
+    }
+
+    for (channel = 0u; channel < channels; ++channel)
+    {
+        scatterElements(src + (channel * plane) + (done * sample_size),
+                        dst + (done * frame) + (channel * sample_size), frames - done, frame, sample_size);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      ringStart
+ *  @package memory_operations
+ *
+ *  @brief   Reduces a free-running offset to a position inside the ring.
+ *
+ *  @details A power-of-two size takes a mask. Any other size takes a division only when the offset has
+ *           actually passed the end of the ring.
+ **/
+static inline size_t ringStart(size_t ring_size, size_t offset)
+{
+    size_t start_out = offset;
+
+    if ((ring_size & (ring_size - 1u)) == 0u)
+    {
+        start_out = offset & (ring_size - 1u);
+    }
+    else if (offset >= ring_size)
+    {
+        start_out = offset % ring_size;
+    }
+
+    return start_out;
+}
+
+/**
+ *  @fn      MEM_copyFromRing
+ *  @package memory_operations
+ *
+ *  @brief   Copies size bytes out of a circular buffer, wrapping at its end.
+ *
+ *  @details The offset is reduced with ringStart, then copyKernel runs on the span up to the end of the ring
+ *           and, if the copy wraps, on the span from the start of the ring. Checks and hooks run once per
+ *           call, so a wrapping copy costs one extra kernel entry and no extra call.
+ *
+ *  @param   ring_base [in]  : Pointer to the first byte of the ring storage.
+ *  @param   ring_size [in]  : Size of the ring storage in bytes.
+ *  @param   offset    [in]  : Position of the first byte to read; may be a free-running counter.
+ *  @param   destine   [out] : Pointer to the linear destination buffer.
+ *  @param   size      [in]  : Bytes to copy, at most ring_size.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Bytes copied (also for size 0).
+ *              * STRUCT_COPY_ERROR     : Empty ring, or size larger than the ring.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copyFromRing(const void *ring_base, size_t ring_size, size_t offset, void *destine,
+                                   size_t size)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    const uint8_t *ring = (const uint8_t *)ring_base;
+    uint8_t *dst = (uint8_t *)destine;
+    size_t start = 0u;
+    size_t first = 0u;
+
+    if (ring_base == NULL || destine == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((ring_size == 0u) || (size > ring_size))
+    {
+        status_out = STRUCT_COPY_ERROR;
+        goto return_status;
+    }
+
+    if (size == 0u)
+    {
+        goto return_status;
+    }
+
+    start = ringStart(ring_size, offset);
+    first = ((ring_size - start) < size) ? (ring_size - start) : size;
+
+    {
+        MEM_TRACE_RECORD(MEM_STATS_COPY, ring + start, destine, size);
+        MEM_STATS_BEGIN();
+
+        copyKernel(dst, ring + start, first);
+
+        if (first != size)
+        {
+            copyKernel(dst + first, ring, size - first);
+        }
+
+        MEM_STATS_END(MEM_STATS_COPY, ring + start, destine, size);
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_copyToRing
+ *  @package memory_operations
+ *
+ *  @brief   Copies size bytes into a circular buffer, wrapping at its end.
+ *
+ *  @details The mirror of MEM_copyFromRing: one reduced offset, at most two copyKernel spans, one set of
+ *           checks and hooks.
+ *
+ *  @param   source    [in]  : Pointer to the linear source buffer.
+ *  @param   ring_base [out] : Pointer to the first byte of the ring storage.
+ *  @param   ring_size [in]  : Size of the ring storage in bytes.
+ *  @param   offset    [in]  : Position of the first byte to write; may be a free-running counter.
+ *  @param   size      [in]  : Bytes to copy, at most ring_size.
+ *
+ *  @return  MEM_struct_copy_t - Returns the copy status, which can be:
+ *              * STRUCT_COPIED         : Bytes copied (also for size 0).
+ *              * STRUCT_COPY_ERROR     : Empty ring, or size larger than the ring.
+ *              * COPY_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_struct_copy_t MEM_copyToRing(const void *source, void *ring_base, size_t ring_size, size_t offset,
+                                 size_t size)
+{
+    MEM_struct_copy_t status_out = STRUCT_COPIED;
+    const uint8_t *src = (const uint8_t *)source;
+    uint8_t *ring = (uint8_t *)ring_base;
+    size_t start = 0u;
+    size_t first = 0u;
+
+    if (source == NULL || ring_base == NULL)
+    {
+        status_out = COPY_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if ((ring_size == 0u) || (size > ring_size))
+    {
+        status_out = STRUCT_COPY_ERROR;
+        goto return_status;
+    }
+
+    if (size == 0u)
+    {
+        goto return_status;
+    }
+
+    start = ringStart(ring_size, offset);
+    first = ((ring_size - start) < size) ? (ring_size - start) : size;
+
+    {
+        MEM_TRACE_RECORD(MEM_STATS_COPY, source, ring + start, size);
+        MEM_STATS_BEGIN();
+
+        copyKernel(ring + start, src, first);
+
+        if (first != size)
+        {
+            copyKernel(ring, src + first, size - first);
+        }
+
+        MEM_STATS_END(MEM_STATS_COPY, source, ring + start, size);
+    }
 
 return_status:
     return status_out;
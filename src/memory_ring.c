@@ -0,0 +1,361 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_ring
+ *  @{
+ *
+ *  @package    memory_ring
+ *  @brief      Lock-free single-producer/single-consumer queue of fixed-size records.
+ *
+ *  @file       memory_ring.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Producer: acquire-load tail, copy the records into the free slots, release-store head.
+ *              Consumer: acquire-load head, copy the records out of the used slots, release-store tail.
+ *              A run of records that crosses the end of the storage is split into one copy up to the end and
+ *              one copy from the start, so a batch never costs more than two burst copies.
+ *
+ *  @see        - memory_ring.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_ring.h"
+
+/* dependencies: */
+#include "memory_arch.h"
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ *  @fn      ringCopyIn
+ *  @package memory_ring
+ *
+ *  @brief   Copies count records into the slots starting at index, wrapping at most once.
+ **/
+static inline void ringCopyIn(MEM_ring_t *ring, uint32_t index, const uint8_t *records, uint32_t count)
+{
+    uint32_t slot = index & ring->mask;
+    uint32_t first = (ring->mask + 1u) - slot;
+
+    if (first > count)
+    {
+        first = count;
+    }
+
+    archBurstCopy(ring->buffer + ((size_t)slot * ring->record_size), records, (size_t)first * ring->record_size);
+
+    if (first < count)
+    {
+        archBurstCopy(ring->buffer, records + ((size_t)first * ring->record_size),
+                      (size_t)(count - first) * ring->record_size);
+    }
+}
+
+/**
+ *  @fn      ringCopyOut
+ *  @package memory_ring
+ *
+ *  @brief   Copies count records out of the slots starting at index, wrapping at most once.
+ **/
+static inline void ringCopyOut(const MEM_ring_t *ring, uint32_t index, uint8_t *records, uint32_t count)
+{
+    uint32_t slot = index & ring->mask;
+    uint32_t first = (ring->mask + 1u) - slot;
+
+    if (first > count)
+    {
+        first = count;
+    }
+
+    archBurstCopy(records, ring->buffer + ((size_t)slot * ring->record_size), (size_t)first * ring->record_size);
+
+    if (first < count)
+    {
+        archBurstCopy(records + ((size_t)first * ring->record_size), ring->buffer,
+                      (size_t)(count - first) * ring->record_size);
+    }
+}
+
+/* =================================
+ *   PUBLIC FUNCTION DEFINITION    *
+ * ================================*/
+
+/**
+ *  @fn      MEM_ringInit
+ *  @package memory_ring
+ *
+ *  @brief   Binds caller-owned storage to an empty ring.
+ *
+ *  @param   ring        [out] : Pointer to the ring.
+ *  @param   storage     [in]  : Storage of capacity * record_size bytes.
+ *  @param   record_size [in]  : Size of one record in bytes.
+ *  @param   capacity    [in]  : Number of records; a power of two no larger than 2^31.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : Ring initialized.
+ *              * RING_BAD_SIZE         : Zero record size, or capacity is not a power of two.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_ring_status_t MEM_ringInit(MEM_ring_t *ring, void *storage, size_t record_size, uint32_t capacity)
+{
+    MEM_ring_status_t status_out = RING_OK;
+
+    if (ring == NULL || storage == NULL)
+    {
+        status_out = RING_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if (record_size == 0u || capacity == 0u || (capacity & (capacity - 1u)) != 0u || capacity > 0x80000000u)
+    {
+        status_out = RING_BAD_SIZE;
+        goto return_status;
+    }
+
+    ring->head = 0u;
+    ring->tail = 0u;
+    ring->mask = capacity - 1u;
+    ring->record_size = record_size;
+    ring->buffer = (uint8_t *)storage;
+
+    archBarrier();
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_ringPush
+ *  @package memory_ring
+ *
+ *  @brief   Appends one record. Producer side only.
+ *
+ *  @param   ring   [in,out] : Pointer to the ring.
+ *  @param   record [in]     : Record of ring->record_size bytes.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : Record queued.
+ *              * RING_FULL             : Ring is full; nothing was queued.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_ring_status_t MEM_ringPush(MEM_ring_t *ring, const void *record)
+{
+    MEM_ring_status_t status_out = RING_OK;
+    uint32_t head = 0u;
+    uint32_t tail = 0u;
+
+    if (ring == NULL || record == NULL)
+    {
+        status_out = RING_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    head = ring->head;
+    tail = archLoadAcquire32(&ring->tail);
+
+    if ((head - tail) > ring->mask)
+    {
+        status_out = RING_FULL;
+        goto return_status;
+    }
+
+    archBurstCopy(ring->buffer + ((size_t)(head & ring->mask) * ring->record_size), record, ring->record_size);
+
+    archStoreRelease32(&ring->head, head + 1u);
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_ringPop
+ *  @package memory_ring
+ *
+ *  @brief   Removes the oldest record. Consumer side only.
+ *
+ *  @param   ring   [in,out] : Pointer to the ring.
+ *  @param   record [out]    : Destination of ring->record_size bytes.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : Record dequeued.
+ *              * RING_EMPTY            : Ring is empty; nothing was dequeued.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_ring_status_t MEM_ringPop(MEM_ring_t *ring, void *record)
+{
+    MEM_ring_status_t status_out = RING_OK;
+    uint32_t head = 0u;
+    uint32_t tail = 0u;
+
+    if (ring == NULL || record == NULL)
+    {
+        status_out = RING_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    tail = ring->tail;
+    head = archLoadAcquire32(&ring->head);
+
+    if (head == tail)
+    {
+        status_out = RING_EMPTY;
+        goto return_status;
+    }
+
+    archBurstCopy(record, ring->buffer + ((size_t)(tail & ring->mask) * ring->record_size), ring->record_size);
+
+    archStoreRelease32(&ring->tail, tail + 1u);
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_ringPushBatch
+ *  @package memory_ring
+ *
+ *  @brief   Appends as many of count contiguous records as fit, with at most two burst copies.
+ *
+ *  @param   ring    [in,out] : Pointer to the ring.
+ *  @param   records [in]     : Array of count records.
+ *  @param   count   [in]     : Number of records offered.
+ *  @param   pushed  [out]    : Number of records actually queued; may be NULL.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : All records queued.
+ *              * RING_FULL             : Only *pushed records fitted.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_ring_status_t MEM_ringPushBatch(MEM_ring_t *ring, const void *records, size_t count, size_t *pushed)
+{
+    MEM_ring_status_t status_out = RING_OK;
+    uint32_t head = 0u;
+    uint32_t tail = 0u;
+    uint32_t space = 0u;
+    uint32_t moved = 0u;
+
+    if (ring == NULL || records == NULL)
+    {
+        status_out = RING_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    head = ring->head;
+    tail = archLoadAcquire32(&ring->tail);
+    space = (ring->mask + 1u) - (head - tail);
+
+    moved = (count < (size_t)space) ? (uint32_t)count : space;
+
+    if (moved < count)
+    {
+        status_out = RING_FULL;
+    }
+
+    if (moved != 0u)
+    {
+        ringCopyIn(ring, head, (const uint8_t *)records, moved);
+        archStoreRelease32(&ring->head, head + moved);
+    }
+
+return_status:
+    if (pushed != NULL)
+    {
+        *pushed = moved;
+    }
+
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_ringPopBatch
+ *  @package memory_ring
+ *
+ *  @brief   Removes up to count of the oldest records, with at most two burst copies.
+ *
+ *  @param   ring    [in,out] : Pointer to the ring.
+ *  @param   records [out]    : Destination array with room for count records.
+ *  @param   count   [in]     : Number of records requested.
+ *  @param   popped  [out]    : Number of records actually dequeued; may be NULL.
+ *
+ *  @return  MEM_ring_status_t - Returns the operation status, which can be:
+ *              * RING_OK               : All requested records dequeued.
+ *              * RING_EMPTY            : Only *popped records were queued.
+ *              * RING_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_ring_status_t MEM_ringPopBatch(MEM_ring_t *ring, void *records, size_t count, size_t *popped)
+{
+    MEM_ring_status_t status_out = RING_OK;
+    uint32_t head = 0u;
+    uint32_t tail = 0u;
+    uint32_t used = 0u;
+    uint32_t moved = 0u;
+
+    if (ring == NULL || records == NULL)
+    {
+        status_out = RING_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    tail = ring->tail;
+    head = archLoadAcquire32(&ring->head);
+    used = head - tail;
+
+    moved = (count < (size_t)used) ? (uint32_t)count : used;
+
+    if (moved < count)
+    {
+        status_out = RING_EMPTY;
+    }
+
+    if (moved != 0u)
+    {
+        ringCopyOut(ring, tail, (uint8_t *)records, moved);
+        archStoreRelease32(&ring->tail, tail + moved);
+    }
+
+return_status:
+    if (popped != NULL)
+    {
+        *popped = moved;
+    }
+
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_ringCount
+ *  @package memory_ring
+ *
+ *  @brief   Returns the number of queued records. Exact for the owner of either side, a snapshot otherwise.
+ *
+ *  @param   ring [in] : Pointer to the ring.
+ *
+ *  @return  uint32_t - Queued records, or zero for a null pointer.
+ **/
+
+uint32_t MEM_ringCount(const MEM_ring_t *ring)
+{
+    uint32_t count_out = 0u;
+
+    if (ring != NULL)
+    {
+        count_out = archLoadAcquire32(&ring->head) - archLoadAcquire32(&ring->tail);
+    }
+
+    return count_out;
+}
+
+/*** end of file ***/
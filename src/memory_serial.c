@@ -0,0 +1,247 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_serial
+ *  @{
+ *
+ *  @package    memory_serial
+ *  @brief      Descriptor-driven packing of C structures into packed wire formats and back.
+ *
+ *  @file       memory_serial.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Each compiled operation is either a plain burst copy or a MEM_copySwapNN call, so packing and
+ *              unpacking are the same loop with source and destination exchanged.
+ *
+ *  @see        - memory_serial.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_serial.h"
+
+/* dependencies: */
+#include "memory_ops.h"
+#include "memory_arch.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def SERIAL_CPU_ENDIAN
+ * @brief Byte order of the CPU as a MEM_serial_endian_t value.
+ **/
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define SERIAL_CPU_ENDIAN           (SERIAL_BIG)
+#else
+#define SERIAL_CPU_ENDIAN           (SERIAL_LITTLE)
+#endif
+
+/**
+ * @def SERIAL_OP_SIZE_MAX
+ * @brief Largest run a single compiled operation can cover.
+ **/
+#define SERIAL_OP_SIZE_MAX          (0xFFFFu)
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ *  @fn      serialRun
+ *  @package memory_serial
+ *
+ *  @brief   Replays the compiled operations; pack and unpack differ only in which side is the wire.
+ **/
+static void serialRun(const MEM_serial_t *serial, const uint8_t *source, uint8_t *destine, int to_wire)
+{
+    const MEM_serial_op_t *op = serial->ops;
+    const MEM_serial_op_t *end = serial->ops + serial->count;
+
+    for (; op < end; ++op)
+    {
+        const uint8_t *src = source + (to_wire ? op->offset : op->wire_offset);
+        uint8_t *dst = destine + (to_wire ? op->wire_offset : op->offset);
+
+        switch (op->swap)
+        {
+            case 2u:
+                (void)MEM_copySwap16(src, dst, op->size);
+                break;
+
+            case 4u:
+                (void)MEM_copySwap32(src, dst, op->size);
+                break;
+
+            case 8u:
+                (void)MEM_copySwap64(src, dst, op->size);
+                break;
+
+            default:
+                archBurstCopy(dst, src, op->size);
+                break;
+        }
+    }
+}
+
+/* =================================
+ *   PUBLIC FUNCTION DEFINITION    *
+ * ================================*/
+
+/**
+ *  @fn      MEM_serialCompile
+ *  @package memory_serial
+ *
+ *  @brief   Compiles a field table into merged copy operations.
+ *
+ *  @param   serial   [out] : Pointer to the compiled format.
+ *  @param   fields   [in]  : Field table.
+ *  @param   count    [in]  : Number of entries in fields.
+ *  @param   ops      [out] : Operation storage; count entries always suffice.
+ *  @param   capacity [in]  : Number of entries in ops.
+ *
+ *  @return  MEM_serial_status_t - Returns the operation status, which can be:
+ *              * SERIAL_OK             : Format compiled.
+ *              * SERIAL_NO_SPACE       : ops cannot hold the merged operations.
+ *              * SERIAL_BAD_FIELD      : Zero-sized field or unknown byte order.
+ *              * SERIAL_BAD_ADDRESS    : Error due to a null pointer.
+ **/
+
+MEM_serial_status_t MEM_serialCompile(MEM_serial_t *serial, const MEM_serial_field_t *fields, size_t count,
+                                      MEM_serial_op_t *ops, size_t capacity)
+{
+    MEM_serial_status_t status_out = SERIAL_OK;
+    MEM_serial_op_t *last = NULL;
+    size_t used = 0u;
+    size_t wire_size = 0u;
+    size_t index = 0u;
+
+    if (serial == NULL || ops == NULL || (fields == NULL && count != 0u))
+    {
+        status_out = SERIAL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    for (index = 0u; index < count; ++index)
+    {
+        const MEM_serial_field_t *field = &fields[index];
+        uint8_t swap = 0u;
+
+        if (field->size == 0u || field->endian > (uint8_t)SERIAL_BIG)
+        {
+            status_out = SERIAL_BAD_FIELD;
+            goto return_status;
+        }
+
+        if (field->endian != (uint8_t)SERIAL_NATIVE && field->endian != (uint8_t)SERIAL_CPU_ENDIAN
+            && (field->size == 2u || field->size == 4u || field->size == 8u))
+        {
+            swap = (uint8_t)field->size;
+        }
+
+        /* Merge with the previous operation when both sides continue it and the swap width matches. */
+        if (last != NULL && last->swap == swap
+            && (size_t)last->offset + last->size == field->offset
+            && (size_t)last->wire_offset + last->size == field->wire_offset
+            && (size_t)last->size + field->size <= SERIAL_OP_SIZE_MAX)
+        {
+            last->size = (uint16_t)(last->size + field->size);
+        }
+        else
+        {
+            if (used == capacity)
+            {
+                status_out = SERIAL_NO_SPACE;
+                goto return_status;
+            }
+
+            last = &ops[used++];
+            last->offset = field->offset;
+            last->size = field->size;
+            last->wire_offset = field->wire_offset;
+            last->swap = swap;
+        }
+
+        if ((size_t)field->wire_offset + field->size > wire_size)
+        {
+            wire_size = (size_t)field->wire_offset + field->size;
+        }
+    }
+
+    serial->ops = ops;
+    serial->count = used;
+    serial->wire_size = wire_size;
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_serialPack
+ *  @package memory_serial
+ *
+ *  @brief   Writes a structure to its wire representation.
+ *
+ *  @param   serial [in]  : Pointer to the compiled format.
+ *  @param   source [in]  : Pointer to the structure.
+ *  @param   wire   [out] : Pointer to at least serial->wire_size bytes.
+ *
+ *  @return  MEM_serial_status_t - Returns the operation status, which can be:
+ *              * SERIAL_OK             : Structure packed.
+ *              * SERIAL_BAD_ADDRESS    : Error due to a null pointer.
+ **/
+
+MEM_serial_status_t MEM_serialPack(const MEM_serial_t *serial, const void *source, void *wire)
+{
+    MEM_serial_status_t status_out = SERIAL_OK;
+
+    if (serial == NULL || source == NULL || wire == NULL)
+    {
+        status_out = SERIAL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    serialRun(serial, (const uint8_t *)source, (uint8_t *)wire, 1);
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_serialUnpack
+ *  @package memory_serial
+ *
+ *  @brief   Reads a structure back from its wire representation. Padding in the structure is left untouched.
+ *
+ *  @param   serial  [in]  : Pointer to the compiled format.
+ *  @param   wire    [in]  : Pointer to at least serial->wire_size bytes.
+ *  @param   destine [out] : Pointer to the structure.
+ *
+ *  @return  MEM_serial_status_t - Returns the operation status, which can be:
+ *              * SERIAL_OK             : Structure unpacked.
+ *              * SERIAL_BAD_ADDRESS    : Error due to a null pointer.
+ **/
+
+MEM_serial_status_t MEM_serialUnpack(const MEM_serial_t *serial, const void *wire, void *destine)
+{
+    MEM_serial_status_t status_out = SERIAL_OK;
+
+    if (serial == NULL || wire == NULL || destine == NULL)
+    {
+        status_out = SERIAL_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    serialRun(serial, (const uint8_t *)wire, (uint8_t *)destine, 0);
+
+return_status:
+    return status_out;
+}
+
+/*** end of file ***/
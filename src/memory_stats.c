@@ -0,0 +1,352 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_stats
+ *  @{
+ *
+ *  @package    memory_stats
+ *  @brief      Optional per-call statistics of the compare, copy and fill entry points.
+ *
+ *  @file       memory_stats.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              One MEM_stats_t per context. Blocks can still be shared (RTOS threads on Cortex-M, nested
+ *              handlers, host threads beyond MEM_STATS_CONTEXTS), so every counter is updated with a relaxed
+ *              atomic add and read or cleared with relaxed accesses; no lock is taken. MEM_getStats reads every
+ *              block and sums them.
+ *
+ *              With MEM_CONFIG_STATS=0 nothing is stored: the API stays linkable and reports STATS_DISABLED.
+ *
+ *  @see        - memory_stats.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_stats.h"
+
+/* dependencies: */
+#include <string.h>
+
+#include "memory_arch.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def STATS_WORD_MASK
+ * @brief Low address bits that must be clear for a word access.
+ **/
+#define STATS_WORD_MASK             ((uintptr_t)(3u))
+
+#if (MEM_CONFIG_STATS != 0)
+
+/**
+ * @def STATS_LOW_HALF
+ * @brief Index of the low 32-bit half of a 64-bit counter.
+ **/
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define STATS_LOW_HALF              (1u)
+#else
+#define STATS_LOW_HALF              (0u)
+#endif
+
+/**
+ * @def MEM_STATS_CONTEXT
+ * @brief Hook returning the counter block of the running context, below MEM_STATS_CONTEXTS.
+ **/
+#ifndef MEM_STATS_CONTEXT
+#define MEM_STATS_CONTEXT()         statsContext()
+#endif
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Counter blocks, one per context.
+ **/
+static MEM_stats_t stats_blocks[MEM_STATS_CONTEXTS];
+
+#if !defined(__arm__)
+/**
+ * @brief Next block handed to a thread, and the block of this thread plus one (zero until assigned).
+ **/
+static uint32_t stats_next_slot;
+static _Thread_local uint32_t stats_thread_slot;
+#endif
+
+/**
+ *  @fn      statsContext
+ *  @package memory_stats
+ *
+ *  @brief   Default MEM_STATS_CONTEXT: exception handler or thread mode on ARM, one block per thread elsewhere.
+ **/
+static inline uint32_t statsContext(void)
+{
+#if defined(__arm__)
+    uint32_t ipsr = 0u;
+
+    asm volatile
+    (
+        "mrs %[ipsr], ipsr                  \n\t"
+        : [ipsr] "=r" (ipsr)
+    );
+
+    return (ipsr != 0u) ? 1u : 0u;
+#else
+    if (stats_thread_slot == 0u)
+    {
+        stats_thread_slot = (__atomic_fetch_add(&stats_next_slot, 1u, __ATOMIC_RELAXED) % MEM_STATS_CONTEXTS) + 1u;
+    }
+
+    return stats_thread_slot - 1u;
+#endif
+}
+
+/**
+ *  @fn      statsAdd64
+ *  @package memory_stats
+ *
+ *  @brief   Relaxed atomic add to a 64-bit counter.
+ *
+ *  @details ARMv7-M has no 64-bit exclusive access, so the low word takes the addend through archFetchAdd32
+ *           and a carry out of it is added to the high word the same way. No count is lost; a concurrent
+ *           reader may see the low word wrapped before the carry lands. The host uses the 64-bit builtin.
+ **/
+static inline void statsAdd64(uint64_t *counter, size_t addend)
+{
+#if defined(__arm__)
+    volatile uint32_t *half = (volatile uint32_t *)counter;
+    const uint32_t previous = archFetchAdd32(&half[STATS_LOW_HALF], (uint32_t)addend);
+
+    if ((uint32_t)(previous + (uint32_t)addend) < previous)
+    {
+        (void)archFetchAdd32(&half[1u - STATS_LOW_HALF], 1u);
+    }
+#else
+    (void)__atomic_fetch_add(counter, (uint64_t)addend, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @fn      statsLoad64
+ *  @package memory_stats
+ *
+ *  @brief   Relaxed load of a 64-bit counter; on ARM the two halves are read separately.
+ **/
+static inline uint64_t statsLoad64(const uint64_t *counter)
+{
+#if defined(__arm__)
+    return *(const volatile uint64_t *)counter;
+#else
+    return __atomic_load_n(counter, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @fn      statsStore64
+ *  @package memory_stats
+ *
+ *  @brief   Relaxed store of a 64-bit counter; on ARM the two halves are written separately.
+ **/
+static inline void statsStore64(uint64_t *counter, uint64_t value)
+{
+#if defined(__arm__)
+    *(volatile uint64_t *)counter = value;
+#else
+    __atomic_store_n(counter, value, __ATOMIC_RELAXED);
+#endif
+}
+
+/**
+ *  @fn      statsBucket
+ *  @package memory_stats
+ *
+ *  @brief   Log2 bucket of value: 0 for 0, otherwise the index of its highest set bit plus one.
+ **/
+static inline uint32_t statsBucket(uint64_t value)
+{
+    uint32_t bucket_out = 0u;
+
+    if (value > (uint64_t)UINT32_MAX)
+    {
+        bucket_out = MEM_STATS_BUCKETS - 1u;
+    }
+    else if (value != 0u)
+    {
+        bucket_out = 32u - (uint32_t)__builtin_clz((uint32_t)value);
+    }
+
+    return bucket_out;
+}
+
+#endif /* #if (MEM_CONFIG_STATS != 0) */
+
+/* =================================
+ *        PUBLIC FUNCTIONS         *
+ * ================================*/
+
+/**
+ *  @fn      MEM_statsRecord
+ *  @package memory_stats
+ *
+ *  @brief   Records one call in the block of the current context. Called by the MEM_STATS_END hook.
+ *
+ *  @details Classifies the pointers as all word aligned, aligned after a common byte head, or misaligned, and
+ *           bumps the call, byte, alignment and histogram counters of the operation with relaxed atomic adds,
+ *           since the block may be shared. Does nothing when statistics are compiled out.
+ *
+ *  @param   operation [in] : Recorded operation.
+ *  @param   ptr_a     [in] : First pointer of the call.
+ *  @param   ptr_b     [in] : Second pointer of the call; the same as ptr_a for fills.
+ *  @param   size      [in] : Size of the call in bytes.
+ *  @param   cycles    [in] : Latency of the call in MEM_CYCLE_COUNTER ticks.
+ **/
+
+void MEM_statsRecord(MEM_stats_op_t operation, const void *ptr_a, const void *ptr_b, size_t size, uint32_t cycles)
+{
+#if (MEM_CONFIG_STATS != 0)
+    MEM_op_stats_t *stats = NULL;
+    uintptr_t offset_a = (uintptr_t)ptr_a & STATS_WORD_MASK;
+    uintptr_t offset_b = (uintptr_t)ptr_b & STATS_WORD_MASK;
+    MEM_stats_align_t align = MEM_STATS_MISALIGNED;
+
+    if ((uint32_t)operation >= (uint32_t)MEM_STATS_OP_COUNT)
+    {
+        return;
+    }
+
+    if ((offset_a | offset_b) == 0u)
+    {
+        align = MEM_STATS_ALIGNED;
+    }
+    else if (offset_a == offset_b)
+    {
+        align = MEM_STATS_CO_ALIGNED;
+    }
+
+    stats = &stats_blocks[MEM_STATS_CONTEXT() % MEM_STATS_CONTEXTS].op[operation];
+
+    (void)archFetchAdd32(&stats->calls, 1u);
+    statsAdd64(&stats->bytes, size);
+    (void)archFetchAdd32(&stats->align[align], 1u);
+    (void)archFetchAdd32(&stats->size_hist[statsBucket((uint64_t)size)], 1u);
+    (void)archFetchAdd32(&stats->cycle_hist[statsBucket((uint64_t)cycles)], 1u);
+#else
+    (void)operation;
+    (void)ptr_a;
+    (void)ptr_b;
+    (void)size;
+    (void)cycles;
+#endif
+}
+
+/**
+ *  @fn      MEM_getStats
+ *  @package memory_stats
+ *
+ *  @brief   Sums the counters of every context into a snapshot.
+ *
+ *  @details Reads each block without stopping its context, so calls recorded during the snapshot may be
+ *           counted partially.
+ *
+ *  @param   stats [out] : Pointer to the snapshot.
+ *
+ *  @return  MEM_stats_status_t - Returns the operation status, which can be:
+ *              * STATS_OK              : Snapshot taken.
+ *              * STATS_DISABLED        : Statistics are compiled out; the snapshot is zeroed.
+ *              * STATS_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+
+MEM_stats_status_t MEM_getStats(MEM_stats_t *stats)
+{
+    MEM_stats_status_t status_out = STATS_OK;
+
+    if (stats == NULL)
+    {
+        status_out = STATS_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    (void)memset(stats, 0, sizeof(*stats));
+
+#if (MEM_CONFIG_STATS != 0)
+    for (uint32_t context = 0u; context < MEM_STATS_CONTEXTS; ++context)
+    {
+        for (uint32_t op = 0u; op < (uint32_t)MEM_STATS_OP_COUNT; ++op)
+        {
+            const MEM_op_stats_t *source = &stats_blocks[context].op[op];
+            MEM_op_stats_t *total = &stats->op[op];
+
+            total->calls += archLoadRelaxed32(&source->calls);
+            total->bytes += statsLoad64(&source->bytes);
+
+            for (uint32_t index = 0u; index < (uint32_t)MEM_STATS_ALIGN_COUNT; ++index)
+            {
+                total->align[index] += archLoadRelaxed32(&source->align[index]);
+            }
+
+            for (uint32_t index = 0u; index < MEM_STATS_BUCKETS; ++index)
+            {
+                total->size_hist[index] += archLoadRelaxed32(&source->size_hist[index]);
+                total->cycle_hist[index] += archLoadRelaxed32(&source->cycle_hist[index]);
+            }
+        }
+    }
+#else
+    status_out = STATS_DISABLED;
+#endif
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_resetStats
+ *  @package memory_stats
+ *
+ *  @brief   Clears the counters of every context.
+ *
+ *  @details Calls recorded by other contexts while the blocks are cleared may survive partially.
+ *
+ *  @return  MEM_stats_status_t - STATS_OK, or STATS_DISABLED when statistics are compiled out.
+ **/
+
+MEM_stats_status_t MEM_resetStats(void)
+{
+#if (MEM_CONFIG_STATS != 0)
+    for (uint32_t context = 0u; context < MEM_STATS_CONTEXTS; ++context)
+    {
+        for (uint32_t op = 0u; op < (uint32_t)MEM_STATS_OP_COUNT; ++op)
+        {
+            MEM_op_stats_t *block = &stats_blocks[context].op[op];
+
+            archStoreRelaxed32(&block->calls, 0u);
+            statsStore64(&block->bytes, 0u);
+
+            for (uint32_t index = 0u; index < (uint32_t)MEM_STATS_ALIGN_COUNT; ++index)
+            {
+                archStoreRelaxed32(&block->align[index], 0u);
+            }
+
+            for (uint32_t index = 0u; index < MEM_STATS_BUCKETS; ++index)
+            {
+                archStoreRelaxed32(&block->size_hist[index], 0u);
+                archStoreRelaxed32(&block->cycle_hist[index], 0u);
+            }
+        }
+    }
+
+    return STATS_OK;
+#else
+    return STATS_DISABLED;
+#endif
+}
+
+/*** end of file ***/
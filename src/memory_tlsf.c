@@ -0,0 +1,587 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_tlsf
+ *  @{
+ *
+ *  @package    memory_tlsf
+ *  @brief      Two-Level Segregated Fit (TLSF) allocator for variable-size blocks with bounded,
+ *              constant-time allocation and release.
+ *
+ *  @file       memory_tlsf.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              Physical block layout (one machine word per cell):
+ *
+ *                  | prev_phys | size | payload ....................... |
+ *                              ^      ^
+ *                              |      +-- pointer returned to the caller
+ *                              +-------- block header while in use
+ *
+ *              The prev_phys cell of a block overlaps the last word of the previous block's payload, so it is
+ *              only written once that previous block is free. Every region ends with a zero-sized, permanently
+ *              used sentinel block, which stops coalescing at the region boundary.
+ *
+ *              Both mapping and search use fls/ffs on 32-bit bitmaps, compiled to a single CLZ on the Cortex-M4.
+ *
+ *  @see        - memory_tlsf.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_tlsf.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def TLSF_BLOCK_FREE_BIT
+ * @brief Size-field flag: this block is free.
+ **/
+#define TLSF_BLOCK_FREE_BIT         ((size_t)(1u))
+
+/**
+ * @def TLSF_BLOCK_PREV_FREE_BIT
+ * @brief Size-field flag: the previous physical block is free.
+ **/
+#define TLSF_BLOCK_PREV_FREE_BIT    ((size_t)(2u))
+
+/**
+ * @def TLSF_BLOCK_FLAGS
+ * @brief Mask of all size-field flags.
+ **/
+#define TLSF_BLOCK_FLAGS            (TLSF_BLOCK_FREE_BIT | TLSF_BLOCK_PREV_FREE_BIT)
+
+/**
+ * @def TLSF_BLOCK_HEADER_OVERHEAD
+ * @brief Bytes a used block costs on top of its payload: the size field.
+ **/
+#define TLSF_BLOCK_HEADER_OVERHEAD  (sizeof(size_t))
+
+/**
+ * @def TLSF_BLOCK_START_OFFSET
+ * @brief Offset from the block header to the payload.
+ **/
+#define TLSF_BLOCK_START_OFFSET     (offsetof(MEM_tlsf_block_t, size) + sizeof(size_t))
+
+/**
+ * @def TLSF_BLOCK_SIZE_MIN
+ * @brief Smallest payload: a free block must hold its list links and the next block's prev_phys.
+ **/
+#define TLSF_BLOCK_SIZE_MIN         (sizeof(MEM_tlsf_block_t) - sizeof(MEM_tlsf_block_t *))
+
+/**
+ * @def TLSF_BLOCK_SIZE_MAX
+ * @brief Largest payload the first-level index can describe.
+ **/
+#define TLSF_BLOCK_SIZE_MAX         ((size_t)(1u) << MEM_TLSF_FL_INDEX_MAX)
+
+/**
+ * @def TLSF_SMALL_BLOCK_SIZE
+ * @brief Sizes below this value are mapped linearly into first-level class 0.
+ **/
+#define TLSF_SMALL_BLOCK_SIZE       ((size_t)(1u) << MEM_TLSF_FL_INDEX_SHIFT)
+
+/**
+ * @def TLSF_REGION_OVERHEAD
+ * @brief Bytes a region loses to bookkeeping: first block header and the end sentinel.
+ **/
+#define TLSF_REGION_OVERHEAD        (2u * TLSF_BLOCK_HEADER_OVERHEAD)
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ *  @fn      tlsfFls
+ *  @package memory_tlsf
+ *
+ *  @brief   Index of the most significant set bit, or -1 for zero - ASSEMBLY: ARM (CLZ).
+ **/
+static inline int tlsfFls(uint32_t word)
+{
+    uint32_t leading = 32u;
+
+#if defined(__arm__)
+    asm
+    (
+        "clz %0, %1                         \n\t"
+        : "=r" (leading)
+        : "r" (word)
+    );
+#else
+    if (word != 0u)
+    {
+        leading = (uint32_t)__builtin_clz(word);
+    }
+#endif
+
+    return 31 - (int)leading;
+}
+
+/**
+ *  @fn      tlsfFfs
+ *  @package memory_tlsf
+ *
+ *  @brief   Index of the least significant set bit, or -1 for zero.
+ **/
+static inline int tlsfFfs(uint32_t word)
+{
+    return tlsfFls(word & (~word + 1u));
+}
+
+static inline size_t tlsfBlockSize(const MEM_tlsf_block_t *block)
+{
+    return block->size & ~TLSF_BLOCK_FLAGS;
+}
+
+static inline int tlsfBlockIsFree(const MEM_tlsf_block_t *block)
+{
+    return (block->size & TLSF_BLOCK_FREE_BIT) != 0u;
+}
+
+static inline int tlsfBlockIsPrevFree(const MEM_tlsf_block_t *block)
+{
+    return (block->size & TLSF_BLOCK_PREV_FREE_BIT) != 0u;
+}
+
+static inline void *tlsfBlockToPtr(const MEM_tlsf_block_t *block)
+{
+    return (void *)((uint8_t *)block + TLSF_BLOCK_START_OFFSET);
+}
+
+static inline MEM_tlsf_block_t *tlsfBlockFromPtr(const void *ptr)
+{
+    return (MEM_tlsf_block_t *)((uint8_t *)ptr - TLSF_BLOCK_START_OFFSET);
+}
+
+/**
+ *  @fn      tlsfBlockNext
+ *  @package memory_tlsf
+ *
+ *  @brief   Next physical block: its prev_phys cell is the last word of this block's payload.
+ **/
+static inline MEM_tlsf_block_t *tlsfBlockNext(const MEM_tlsf_block_t *block)
+{
+    return (MEM_tlsf_block_t *)((uint8_t *)tlsfBlockToPtr(block)
+                                + tlsfBlockSize(block) - sizeof(MEM_tlsf_block_t *));
+}
+
+/**
+ *  @fn      tlsfMappingInsert
+ *  @package memory_tlsf
+ *
+ *  @brief   Maps a block size to the free list that stores it.
+ **/
+static inline void tlsfMappingInsert(size_t size, int *fl, int *sl)
+{
+    int fl_index = 0;
+    int sl_index = 0;
+
+    if (size < TLSF_SMALL_BLOCK_SIZE)
+    {
+        sl_index = (int)(size >> MEM_TLSF_ALIGN_LOG2);
+    }
+    else
+    {
+        fl_index = tlsfFls((uint32_t)size);
+        sl_index = (int)(size >> ((unsigned)fl_index - MEM_TLSF_SL_INDEX_LOG2)) ^ (int)MEM_TLSF_SL_INDEX_COUNT;
+        fl_index -= (int)MEM_TLSF_FL_INDEX_SHIFT - 1;
+    }
+
+    *fl = fl_index;
+    *sl = sl_index;
+}
+
+/**
+ *  @fn      tlsfMappingSearch
+ *  @package memory_tlsf
+ *
+ *  @brief   Maps a request to the first list whose every block is large enough (good fit, no list walk).
+ **/
+static inline void tlsfMappingSearch(size_t size, int *fl, int *sl)
+{
+    if (size >= TLSF_SMALL_BLOCK_SIZE)
+    {
+        size += ((size_t)(1u) << ((unsigned)tlsfFls((uint32_t)size) - MEM_TLSF_SL_INDEX_LOG2)) - 1u;
+    }
+
+    tlsfMappingInsert(size, fl, sl);
+}
+
+/**
+ *  @fn      tlsfSearchSuitableBlock
+ *  @package memory_tlsf
+ *
+ *  @brief   Finds the first non-empty list at or above (fl, sl) using the bitmaps; updates fl/sl.
+ **/
+static inline MEM_tlsf_block_t *tlsfSearchSuitableBlock(MEM_tlsf_t *tlsf, int *fl, int *sl)
+{
+    MEM_tlsf_block_t *block_out = NULL;
+    uint32_t sl_map = 0u;
+    uint32_t fl_map = 0u;
+    int fl_index = *fl;
+
+    sl_map = tlsf->sl_bitmap[fl_index] & (~0u << (unsigned)*sl);
+
+    if (sl_map == 0u)
+    {
+        fl_map = tlsf->fl_bitmap & (~0u << (unsigned)(fl_index + 1));
+
+        if (fl_map == 0u)
+        {
+            goto return_block;
+        }
+
+        fl_index = tlsfFfs(fl_map);
+        sl_map = tlsf->sl_bitmap[fl_index];
+    }
+
+    *fl = fl_index;
+    *sl = tlsfFfs(sl_map);
+    block_out = tlsf->blocks[fl_index][*sl];
+
+return_block:
+    return block_out;
+}
+
+static inline void tlsfRemoveFreeBlock(MEM_tlsf_t *tlsf, MEM_tlsf_block_t *block, int fl, int sl)
+{
+    MEM_tlsf_block_t *prev = block->prev_free;
+    MEM_tlsf_block_t *next = block->next_free;
+
+    next->prev_free = prev;
+    prev->next_free = next;
+
+    if (tlsf->blocks[fl][sl] == block)
+    {
+        tlsf->blocks[fl][sl] = next;
+
+        if (next == &tlsf->null_block)
+        {
+            tlsf->sl_bitmap[fl] &= ~(1u << (unsigned)sl);
+
+            if (tlsf->sl_bitmap[fl] == 0u)
+            {
+                tlsf->fl_bitmap &= ~(1u << (unsigned)fl);
+            }
+        }
+    }
+}
+
+static inline void tlsfInsertFreeBlock(MEM_tlsf_t *tlsf, MEM_tlsf_block_t *block)
+{
+    MEM_tlsf_block_t *current = NULL;
+    int fl = 0;
+    int sl = 0;
+
+    tlsfMappingInsert(tlsfBlockSize(block), &fl, &sl);
+
+    current = tlsf->blocks[fl][sl];
+    block->next_free = current;
+    block->prev_free = &tlsf->null_block;
+    current->prev_free = block;
+
+    tlsf->blocks[fl][sl] = block;
+    tlsf->fl_bitmap |= (1u << (unsigned)fl);
+    tlsf->sl_bitmap[fl] |= (1u << (unsigned)sl);
+}
+
+static inline void tlsfRemoveBlock(MEM_tlsf_t *tlsf, MEM_tlsf_block_t *block)
+{
+    int fl = 0;
+    int sl = 0;
+
+    tlsfMappingInsert(tlsfBlockSize(block), &fl, &sl);
+    tlsfRemoveFreeBlock(tlsf, block, fl, sl);
+}
+
+/**
+ *  @fn      tlsfPrepareUsed
+ *  @package memory_tlsf
+ *
+ *  @brief   Marks a free block used, splitting off the tail as a new free block when it is large enough.
+ **/
+static inline void *tlsfPrepareUsed(MEM_tlsf_t *tlsf, MEM_tlsf_block_t *block, size_t size)
+{
+    MEM_tlsf_block_t *remaining = NULL;
+    MEM_tlsf_block_t *next = NULL;
+    size_t block_size = tlsfBlockSize(block);
+
+    if (block_size >= size + TLSF_BLOCK_HEADER_OVERHEAD + TLSF_BLOCK_SIZE_MIN)
+    {
+        remaining = (MEM_tlsf_block_t *)((uint8_t *)tlsfBlockToPtr(block) + size - sizeof(MEM_tlsf_block_t *));
+        remaining->size = (block_size - size - TLSF_BLOCK_HEADER_OVERHEAD) | TLSF_BLOCK_FREE_BIT;
+        block->size = size | (block->size & TLSF_BLOCK_PREV_FREE_BIT);
+
+        next = tlsfBlockNext(remaining);
+        next->prev_phys = remaining;
+        next->size |= TLSF_BLOCK_PREV_FREE_BIT;
+
+        tlsfInsertFreeBlock(tlsf, remaining);
+    }
+    else
+    {
+        block->size &= ~TLSF_BLOCK_FREE_BIT;
+        tlsfBlockNext(block)->size &= ~TLSF_BLOCK_PREV_FREE_BIT;
+    }
+
+    return tlsfBlockToPtr(block);
+}
+
+/* =================================
+ *   PUBLIC FUNCTION DEFINITION    *
+ * ================================*/
+
+/**
+ *  @fn      MEM_tlsfInit
+ *  @package memory_tlsf
+ *
+ *  @brief   Resets an allocator control block to the empty state.
+ *
+ *  @param   tlsf [out] : Pointer to the control block.
+ *
+ *  @return  MEM_tlsf_status_t - Returns the operation status, which can be:
+ *              * TLSF_OK               : Control block initialized.
+ *              * TLSF_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_tlsf_status_t MEM_tlsfInit(MEM_tlsf_t *tlsf)
+{
+    MEM_tlsf_status_t status_out = TLSF_OK;
+    size_t fl = 0u;
+    size_t sl = 0u;
+
+    if (tlsf == NULL)
+    {
+        status_out = TLSF_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    tlsf->null_block.next_free = &tlsf->null_block;
+    tlsf->null_block.prev_free = &tlsf->null_block;
+    tlsf->fl_bitmap = 0u;
+
+    for (fl = 0u; fl < MEM_TLSF_FL_INDEX_COUNT; ++fl)
+    {
+        tlsf->sl_bitmap[fl] = 0u;
+
+        for (sl = 0u; sl < MEM_TLSF_SL_INDEX_COUNT; ++sl)
+        {
+            tlsf->blocks[fl][sl] = &tlsf->null_block;
+        }
+    }
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_tlsfAddRegion
+ *  @package memory_tlsf
+ *
+ *  @brief   Hands a caller-supplied memory region to the allocator.
+ *
+ *  @param   tlsf   [in,out] : Pointer to the control block.
+ *  @param   region [in]     : Start of the region, aligned to MEM_TLSF_ALIGN_SIZE.
+ *  @param   size   [in]     : Size of the region in bytes.
+ *
+ *  @return  MEM_tlsf_status_t - Returns the operation status, which can be:
+ *              * TLSF_OK               : Region added.
+ *              * TLSF_REGION_TOO_SMALL : Region cannot hold a block, or exceeds the largest block size.
+ *              * TLSF_BAD_ALIGNMENT    : Region is misaligned.
+ *              * TLSF_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_tlsf_status_t MEM_tlsfAddRegion(MEM_tlsf_t *tlsf, void *region, size_t size)
+{
+    MEM_tlsf_status_t status_out = TLSF_OK;
+    MEM_tlsf_block_t *block = NULL;
+    MEM_tlsf_block_t *sentinel = NULL;
+    size_t block_size = 0u;
+
+    if (tlsf == NULL || region == NULL)
+    {
+        status_out = TLSF_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    if (((uintptr_t)region & (MEM_TLSF_ALIGN_SIZE - 1u)) != 0u)
+    {
+        status_out = TLSF_BAD_ALIGNMENT;
+        goto return_status;
+    }
+
+    if (size < TLSF_REGION_OVERHEAD + TLSF_BLOCK_SIZE_MIN)
+    {
+        status_out = TLSF_REGION_TOO_SMALL;
+        goto return_status;
+    }
+
+    block_size = (size - TLSF_REGION_OVERHEAD) & ~(size_t)(MEM_TLSF_ALIGN_SIZE - 1u);
+
+    if (block_size < TLSF_BLOCK_SIZE_MIN || block_size >= TLSF_BLOCK_SIZE_MAX)
+    {
+        status_out = TLSF_REGION_TOO_SMALL;
+        goto return_status;
+    }
+
+    /* The first block's prev_phys cell lies before the region; it is never touched because prev is "used". */
+    block = (MEM_tlsf_block_t *)((uint8_t *)region - sizeof(MEM_tlsf_block_t *));
+    block->size = block_size | TLSF_BLOCK_FREE_BIT;
+    tlsfInsertFreeBlock(tlsf, block);
+
+    sentinel = tlsfBlockNext(block);
+    sentinel->prev_phys = block;
+    sentinel->size = (size_t)(0u) | TLSF_BLOCK_PREV_FREE_BIT;
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_tlsfMalloc
+ *  @package memory_tlsf
+ *
+ *  @brief   Allocates a block of at least the requested size in constant time.
+ *
+ *  @param   tlsf [in,out] : Pointer to the control block.
+ *  @param   size [in]     : Requested size in bytes.
+ *
+ *  @return  void* - Pointer to the block, or NULL when no block is large enough or size is zero.
+ **/
+
+void *MEM_tlsfMalloc(MEM_tlsf_t *tlsf, size_t size)
+{
+    void *ptr_out = NULL;
+    MEM_tlsf_block_t *block = NULL;
+    size_t adjusted = 0u;
+    int fl = 0;
+    int sl = 0;
+
+    if (tlsf == NULL || size == 0u || size >= TLSF_BLOCK_SIZE_MAX)
+    {
+        goto return_ptr;
+    }
+
+    adjusted = (size + (MEM_TLSF_ALIGN_SIZE - 1u)) & ~(size_t)(MEM_TLSF_ALIGN_SIZE - 1u);
+
+    if (adjusted < TLSF_BLOCK_SIZE_MIN)
+    {
+        adjusted = TLSF_BLOCK_SIZE_MIN;
+    }
+
+    tlsfMappingSearch(adjusted, &fl, &sl);
+
+    if (fl >= (int)MEM_TLSF_FL_INDEX_COUNT)
+    {
+        goto return_ptr;
+    }
+
+    block = tlsfSearchSuitableBlock(tlsf, &fl, &sl);
+
+    if (block == NULL || block == &tlsf->null_block)
+    {
+        goto return_ptr;
+    }
+
+    tlsfRemoveFreeBlock(tlsf, block, fl, sl);
+    ptr_out = tlsfPrepareUsed(tlsf, block, adjusted);
+
+return_ptr:
+    return ptr_out;
+}
+
+/**
+ *  @fn      MEM_tlsfFree
+ *  @package memory_tlsf
+ *
+ *  @brief   Releases a block in constant time, merging it with free physical neighbours.
+ *
+ *  @param   tlsf [in,out] : Pointer to the control block.
+ *  @param   ptr  [in]     : Block returned by MEM_tlsfMalloc.
+ *
+ *  @return  MEM_tlsf_status_t - Returns the operation status, which can be:
+ *              * TLSF_OK               : Block released.
+ *              * TLSF_NOT_ALLOCATED    : Block was already free.
+ *              * TLSF_BAD_ADDRESS      : Error due to a null pointer.
+ **/
+
+MEM_tlsf_status_t MEM_tlsfFree(MEM_tlsf_t *tlsf, void *ptr)
+{
+    MEM_tlsf_status_t status_out = TLSF_OK;
+    MEM_tlsf_block_t *block = NULL;
+    MEM_tlsf_block_t *prev = NULL;
+    MEM_tlsf_block_t *next = NULL;
+
+    if (tlsf == NULL || ptr == NULL)
+    {
+        status_out = TLSF_BAD_ADDRESS;
+        goto return_status;
+    }
+
+    block = tlsfBlockFromPtr(ptr);
+
+    if (tlsfBlockIsFree(block))
+    {
+        status_out = TLSF_NOT_ALLOCATED;
+        goto return_status;
+    }
+
+    if (tlsfBlockIsPrevFree(block))
+    {
+        prev = block->prev_phys;
+        tlsfRemoveBlock(tlsf, prev);
+        prev->size += tlsfBlockSize(block) + TLSF_BLOCK_HEADER_OVERHEAD;
+        block = prev;
+    }
+
+    next = tlsfBlockNext(block);
+
+    if (tlsfBlockIsFree(next))
+    {
+        tlsfRemoveBlock(tlsf, next);
+        block->size += tlsfBlockSize(next) + TLSF_BLOCK_HEADER_OVERHEAD;
+        next = tlsfBlockNext(block);
+    }
+
+    block->size |= TLSF_BLOCK_FREE_BIT;
+    next->prev_phys = block;
+    next->size |= TLSF_BLOCK_PREV_FREE_BIT;
+
+    tlsfInsertFreeBlock(tlsf, block);
+
+return_status:
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_tlsfBlockSize
+ *  @package memory_tlsf
+ *
+ *  @brief   Returns the usable size of an allocated block.
+ *
+ *  @param   ptr [in] : Block returned by MEM_tlsfMalloc.
+ *
+ *  @return  size_t - Usable size in bytes, or zero for a null pointer.
+ **/
+
+size_t MEM_tlsfBlockSize(const void *ptr)
+{
+    size_t size_out = 0u;
+
+    if (ptr != NULL)
+    {
+        size_out = tlsfBlockSize(tlsfBlockFromPtr(ptr));
+    }
+
+    return size_out;
+}
+
+/*** end of file ***/
@@ -0,0 +1,239 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_trace
+ *  @{
+ *
+ *  @package    memory_trace
+ *  @brief      Optional capture of the compare, copy and fill calls into a binary ring for offline replay.
+ *
+ *  @file       memory_trace.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              trace_head counts every record ever claimed. A record takes slot (head & mask), so once the
+ *              count passes MEM_TRACE_RECORDS the newest record overwrites the oldest one, and the ring holds
+ *              the records [head - MEM_TRACE_RECORDS, head).
+ *
+ *              With MEM_CONFIG_TRACE=0 nothing is stored: the API stays linkable and reports TRACE_DISABLED.
+ *
+ *  @see        - memory_trace.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_trace.h"
+
+/* dependencies: */
+#include <string.h>
+
+#include "memory_arch.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def TRACE_MASK
+ * @brief Slot index mask of the ring.
+ **/
+#define TRACE_MASK                  ((uint32_t)MEM_TRACE_RECORDS - 1u)
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+#if (MEM_CONFIG_TRACE != 0)
+/**
+ * @brief Ring of captured records and the number of records ever claimed.
+ **/
+static MEM_trace_record_t trace_records[MEM_TRACE_RECORDS];
+static volatile uint32_t trace_head;
+#endif
+
+/**
+ *  @fn      traceCount
+ *  @package memory_trace
+ *
+ *  @brief   Records currently held by the ring and records already overwritten, for a given head.
+ **/
+static inline uint32_t traceCount(uint32_t head, uint32_t *dropped)
+{
+    uint32_t count_out = head;
+
+    *dropped = 0u;
+
+    if (count_out > (uint32_t)MEM_TRACE_RECORDS)
+    {
+        *dropped = count_out - (uint32_t)MEM_TRACE_RECORDS;
+        count_out = (uint32_t)MEM_TRACE_RECORDS;
+    }
+
+    return count_out;
+}
+
+/* =================================
+ *        PUBLIC FUNCTIONS         *
+ * ================================*/
+
+/**
+ *  @fn      MEM_traceRecord
+ *  @package memory_trace
+ *
+ *  @brief   Appends one call to the ring. Called by the MEM_TRACE_RECORD hook.
+ *
+ *  @details Claims the next slot with an atomic increment, then fills it. Does nothing when tracing is
+ *           compiled out.
+ *
+ *  @param   operation [in] : Recorded operation.
+ *  @param   source    [in] : Source pointer (compare: first structure; fill: the structure).
+ *  @param   destine   [in] : Destination pointer (compare: second structure; fill: the structure).
+ *  @param   size      [in] : Size of the call in bytes.
+ **/
+
+void MEM_traceRecord(MEM_stats_op_t operation, const void *source, const void *destine, size_t size)
+{
+#if (MEM_CONFIG_TRACE != 0)
+    const uint32_t timestamp = MEM_CYCLE_COUNTER();
+    MEM_trace_record_t *record = &trace_records[archFetchAdd32(&trace_head, 1u) & TRACE_MASK];
+
+    record->timestamp = timestamp;
+    record->size = (size > (size_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)size;
+    record->operation = (uint8_t)operation;
+    record->src_offset = (uint8_t)((uintptr_t)source % MEM_TRACE_LINE);
+    record->dst_offset = (uint8_t)((uintptr_t)destine % MEM_TRACE_LINE);
+    record->reserved = 0u;
+#else
+    (void)operation;
+    (void)source;
+    (void)destine;
+    (void)size;
+#endif
+}
+
+/**
+ *  @fn      MEM_traceDumpSize
+ *  @package memory_trace
+ *
+ *  @brief   Returns the number of bytes MEM_traceDump currently needs.
+ *
+ *  @details The value only grows until the ring is full, so a buffer of sizeof(MEM_trace_header_t) +
+ *           MEM_TRACE_RECORDS * sizeof(MEM_trace_record_t) bytes always suffices.
+ *
+ *  @return  size_t - Header plus captured records.
+ **/
+
+size_t MEM_traceDumpSize(void)
+{
+    uint32_t dropped = 0u;
+    uint32_t head = 0u;
+
+#if (MEM_CONFIG_TRACE != 0)
+    head = archLoadAcquire32(&trace_head);
+#endif
+
+    return sizeof(MEM_trace_header_t) + ((size_t)traceCount(head, &dropped) * sizeof(MEM_trace_record_t));
+}
+
+/**
+ *  @fn      MEM_traceDump
+ *  @package memory_trace
+ *
+ *  @brief   Serializes the captured records, oldest first, behind a MEM_trace_header_t.
+ *
+ *  @details The ring is copied in at most two runs: from the oldest slot to the end of the storage, then
+ *           from the start of the storage to the newest slot.
+ *
+ *  @param   buffer  [out] : Destination of the dump.
+ *  @param   size    [in]  : Size of the destination in bytes.
+ *  @param   written [out] : Optional; bytes written, or bytes needed on TRACE_NO_SPACE.
+ *
+ *  @return  MEM_trace_status_t - Returns the operation status, which can be:
+ *              * TRACE_OK              : Dump written.
+ *              * TRACE_DISABLED        : Tracing is compiled out; a header with no record is written.
+ *              * TRACE_NO_SPACE        : Buffer too small; nothing written.
+ *              * TRACE_BAD_ADDRESS     : Error due to a null pointer.
+ **/
+
+MEM_trace_status_t MEM_traceDump(void *buffer, size_t size, size_t *written)
+{
+    MEM_trace_status_t status_out = TRACE_OK;
+    MEM_trace_header_t header = { MEM_TRACE_MAGIC, (uint16_t)MEM_TRACE_VERSION,
+                                  (uint16_t)sizeof(MEM_trace_record_t), 0u, 0u };
+    uint32_t head = 0u;
+    size_t needed = 0u;
+
+    if (buffer == NULL)
+    {
+        status_out = TRACE_BAD_ADDRESS;
+        goto return_status;
+    }
+
+#if (MEM_CONFIG_TRACE != 0)
+    head = archLoadAcquire32(&trace_head);
+#else
+    status_out = TRACE_DISABLED;
+#endif
+
+    header.count = traceCount(head, &header.dropped);
+    needed = sizeof(header) + ((size_t)header.count * sizeof(MEM_trace_record_t));
+
+    if (size < needed)
+    {
+        status_out = TRACE_NO_SPACE;
+        goto return_status;
+    }
+
+    (void)memcpy(buffer, &header, sizeof(header));
+
+#if (MEM_CONFIG_TRACE != 0)
+    {
+        uint8_t *records = (uint8_t *)buffer + sizeof(header);
+        const uint32_t oldest = (head - header.count) & TRACE_MASK;
+        uint32_t first = (uint32_t)MEM_TRACE_RECORDS - oldest;
+
+        if (first > header.count)
+        {
+            first = header.count;
+        }
+
+        (void)memcpy(records, &trace_records[oldest], (size_t)first * sizeof(MEM_trace_record_t));
+        (void)memcpy(records + ((size_t)first * sizeof(MEM_trace_record_t)), &trace_records[0],
+                     (size_t)(header.count - first) * sizeof(MEM_trace_record_t));
+    }
+#endif
+
+return_status:
+    if (written != NULL)
+    {
+        *written = needed;
+    }
+
+    return status_out;
+}
+
+/**
+ *  @fn      MEM_traceReset
+ *  @package memory_trace
+ *
+ *  @brief   Discards the captured records.
+ *
+ *  @return  MEM_trace_status_t - TRACE_OK, or TRACE_DISABLED when tracing is compiled out.
+ **/
+
+MEM_trace_status_t MEM_traceReset(void)
+{
+#if (MEM_CONFIG_TRACE != 0)
+    archStoreRelease32(&trace_head, 0u);
+
+    return TRACE_OK;
+#else
+    return TRACE_DISABLED;
+#endif
+}
+
+/*** end of file ***/
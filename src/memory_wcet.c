@@ -0,0 +1,246 @@
+/**
+ *  @ingroup    MemoryManagement
+ *  @addtogroup MemoryManagement memory_wcet
+ *  @{
+ *
+ *  @package    memory_wcet
+ *  @brief      Worst-case cycle bounds of the compare, copy and fill kernels for schedulability analysis.
+ *
+ *  @file       memory_wcet.c
+ *  @author     Rafael V. Volkmer (rafael.v.volkmer@gmail.com)
+ *
+ *  @date       16.10.2026
+ *
+ *  @details
+ *              One wcetKernel_t per operation of the active MEM_CONFIG_PROFILE. Every cost is written as
+ *              WCET_COST(cycles, data accesses); the comment next to it lists the instructions it sums. The loops
+ *              are assembly, so their sequences are fixed: the byte loops of the heads and tails (archCopyBytes
+ *              ldrb 2, strb 2; archFillBytes strb 2; archCompareBytes ldrb 2, ldrb 2, cmp 1, bne 1; each then
+ *              subs 1, bne 4), the word loops and the LDM/STM bursts of memory_ops.c.
+ *
+ *              The glue between the loops is compiled C: the NULL and zero tests, archWordHead, the pointer and
+ *              size updates and the register moves around the asm operands. Its layout is the compiler's choice,
+ *              so every conditional branch in it is budgeted as taken (cmp 1, branch 4), an IT instruction as
+ *              one cycle, and the register moves as counted in the -O2 disassembly of bench/memory_bench_m4.sh.
+ *              Rerun that script after changing compiler or flags.
+ *
+ *              Shared setup, WCET_CALL: BL 4, PUSH 6, frame pointer 1, two NULL tests 10, epilogue 10 (POP with
+ *              PC, or POP and BX LR), status moves 2. SPEED also saves r8-r11: WCET_CALL_SPEED adds a second PUSH
+ *              and POP of up to three registers, 4 each. With MEM_CONFIG_RAMFUNC the call is a long call,
+ *              WCET_LONG_CALL.
+ *
+ *  @see        - memory_wcet.h
+ **/
+
+/* =================================
+ *       PRIVATE INCLUDE FILES     *
+ * ================================*/
+
+/* implemented: */
+#include "memory_wcet.h"
+
+/* =================================
+ *          PRIVATE DEFINES        *
+ * ================================*/
+
+/**
+ * @def WCET_COST
+ * @brief Cycles of an instruction sequence performing the given number of data accesses.
+ **/
+#define WCET_COST(cycles, accesses) ((uint32_t)(cycles) + ((uint32_t)(accesses) * (uint32_t)MEM_CONFIG_WAIT_STATES))
+
+/**
+ * @def WCET_LONG_CALL
+ * @brief Extra cost of calling a MEM_RAMFUNC entry point over a BL: GCC's long_call loads the address from a
+ *        literal pool and calls it with BLX (LDR 2, one access), a linker veneer adds MOVW, MOVT and BX (6).
+ **/
+#if (MEM_CONFIG_RAMFUNC != 0)
+#define WCET_LONG_CALL              WCET_COST(6u, 1u)
+#else
+#define WCET_LONG_CALL              (0u)
+#endif
+
+/**
+ * @def WCET_CALL
+ * @brief Call, checks, prologue and epilogue of an entry point.
+ **/
+#define WCET_CALL                   (33u + WCET_LONG_CALL)
+
+/**
+ * @def WCET_CALL_SPEED
+ * @brief WCET_CALL with the extra callee-saved registers of the SPEED bursts.
+ **/
+#define WCET_CALL_SPEED             (WCET_CALL + 8u)
+
+/**
+ * @def WCET_BURST_TEST
+ * @brief Equality test of a four-word burst: usad8 1, usada8 3, cmp 1 with the DSP extension, otherwise
+ *        eor 4, orr 3.
+ **/
+#if defined(__ARM_FEATURE_DSP)
+#define WCET_BURST_TEST             (5u)
+#else
+#define WCET_BURST_TEST             (7u)
+#endif
+
+/* =================================
+ *          PRIVATE TYPES          *
+ * ================================*/
+
+/**
+ * @struct wcetKernel
+ * @brief Cost of each phase of one kernel, in cycles.
+ **/
+typedef struct wcetKernel
+{
+    uint32_t setup;             /**< Everything executed once per call */
+    uint32_t head;              /**< Per byte before the pointers are word aligned */
+    uint32_t burst_bytes;       /**< Bytes per LDM/STM burst, 0 without bursts */
+    uint32_t burst;             /**< Per burst */
+    uint32_t word;              /**< Per whole word, 0 for a byte-only kernel */
+    uint32_t tail;              /**< Per byte after the last whole word */
+    uint32_t byte;              /**< Per byte of the byte-only path (misaligned buffers, SIZE) */
+    uint32_t rescan_bytes;      /**< Bytes a compare re-reads after a differing word or burst */
+} wcetKernel_t;
+
+/* =================================
+ *   PRIVATE FUNCTION DECLARATION  *
+ * ================================*/
+
+/**
+ * @brief Phase costs of the active profile, indexed by MEM_stats_op_t.
+ **/
+static const wcetKernel_t wcet_kernels[MEM_STATS_OP_COUNT] =
+{
+#if (MEM_CONFIG_PROFILE == MEM_PROFILE_SIZE)
+    /* compare: register move 1, size test 5, exit b/mov 5. Byte: ldrb 2, ldrb 2, cmp 1, bne 1, subs 1, bne 4. */
+    { WCET_CALL + 11u, 0u, 0u, 0u, 0u, 0u, WCET_COST(11u, 2u), 0u },
+    /* copy: size test 5. Byte: ldrb 2, strb 2, subs 1, bne 4. */
+    { WCET_CALL + 5u, 0u, 0u, 0u, 0u, 0u, WCET_COST(9u, 2u), 0u },
+    /* fill: mov 1, size test 5. Byte: strb 2, subs 1, bne 4. */
+    { WCET_CALL + 6u, 0u, 0u, 0u, 0u, 0u, WCET_COST(7u, 1u), 0u },
+#elif (MEM_CONFIG_PROFILE == MEM_PROFILE_BALANCED)
+    /* compare: r11 save and restore 4, register moves 4, size test 2, alignment test 6, archWordHead 5, head
+     * zero test 5, head result test 4, pointer updates 3, word exit 5, tail test 5, byte exit 9 (b, mov, b).
+     * Head, tail and byte (archCompareBytes and the byte loop): ldrb 2, ldrb 2, cmp 1, bne 1, subs 1, bne 4.
+     * Word: cmp 1, blo 1, ldr 2, ldr 2, cmp 1, bne 1, sub 1, b 4; a differing word exits through bne 4 and
+     * back4 2 for the same 13. */
+    { WCET_CALL + 52u, WCET_COST(11u, 2u), 0u, 0u, WCET_COST(13u, 2u), WCET_COST(11u, 2u),
+      WCET_COST(11u, 2u), 4u },
+    /* copy (archBurstCopy): alignment test 6, archWordHead 5, register moves 3, head zero test 5, pointer
+     * updates 3, burst entry 5, word exit 5, tail zero test 5. Head, tail and byte (archCopyBytes): ldrb 2,
+     * strb 2, subs 1, bne 4. Burst: ldm 5, stm 5, sub 1, cmp 1, bhs 4. Word: cmp 1, blo 1, ldr 2, str 2,
+     * sub 1, b 4. */
+    { WCET_CALL + 37u, WCET_COST(9u, 2u), 16u, WCET_COST(16u, 8u), WCET_COST(11u, 2u), WCET_COST(9u, 2u),
+      WCET_COST(9u, 2u), 0u },
+    /* fill: pattern 2, archWordHead 5, register move 1, head zero test 5, pointer updates 2, word exit 5, tail
+     * zero test 5. Head and tail (archFillBytes): strb 2, subs 1, bne 4. Word: cmp 1, blo 1, str 2, sub 1,
+     * b 4. */
+    { WCET_CALL + 25u, WCET_COST(7u, 1u), 0u, 0u, WCET_COST(9u, 1u), WCET_COST(7u, 1u),
+      WCET_COST(7u, 1u), 0u },
+#else
+    /* compare: as BALANCED with r11 in the second PUSH, plus burst entry 5. Burst: ldm 5, ldm 5, test
+     * WCET_BURST_TEST, bne 1, sub 1, cmp 1, bhs 4; a differing burst exits through bne 4, back16 2 and back4 2
+     * for less. */
+    { WCET_CALL_SPEED + 53u, WCET_COST(11u, 2u), 16u, WCET_COST(17u + WCET_BURST_TEST, 8u),
+      WCET_COST(13u, 2u), WCET_COST(11u, 2u), WCET_COST(11u, 2u), 16u },
+    /* copy: as BALANCED. Burst: ldm 9, stm 9, sub 1, cmp 1, bhs 4. */
+    { WCET_CALL_SPEED + 37u, WCET_COST(9u, 2u), 32u, WCET_COST(24u, 16u), WCET_COST(11u, 2u),
+      WCET_COST(9u, 2u), WCET_COST(9u, 2u), 0u },
+    /* fill: as BALANCED plus eight pattern moves 8 and burst entry 5. Burst: stm 9, sub 1, cmp 1, bhs 4. */
+    { WCET_CALL_SPEED + 38u, WCET_COST(7u, 1u), 32u, WCET_COST(15u, 8u), WCET_COST(9u, 1u),
+      WCET_COST(7u, 1u), WCET_COST(7u, 1u), 0u },
+#endif
+};
+
+/**
+ *  @fn      wcetAligned
+ *  @package memory_wcet
+ *
+ *  @brief   Cost of the word-aligned path after a head of head_bytes bytes.
+ **/
+static inline uint64_t wcetAligned(const wcetKernel_t *kernel, uint64_t size, uint64_t head_bytes)
+{
+    const uint64_t body = size - head_bytes;
+    uint64_t bursts = 0u;
+    uint64_t rest = body;
+
+    if (kernel->burst_bytes != 0u)
+    {
+        bursts = body / kernel->burst_bytes;
+        rest = body - (bursts * kernel->burst_bytes);
+    }
+
+    return (uint64_t)kernel->setup + (head_bytes * kernel->head) + (bursts * kernel->burst)
+           + ((rest / 4u) * kernel->word) + ((rest % 4u) * kernel->tail)
+           + ((uint64_t)kernel->rescan_bytes * kernel->tail);
+}
+
+/* =================================
+ *        PUBLIC FUNCTIONS         *
+ * ================================*/
+
+/**
+ *  @fn      MEM_cycleBound
+ *  @package memory_wcet
+ *
+ *  @brief   Upper bound on the Cortex-M4 cycles of one compare, copy or fill call.
+ *
+ *  @details Byte-only kernels cost setup + size * byte. Word-aligned pointers take the aligned path with no
+ *           head. Co-aligned pointers take it after a head of 1 to 3 bytes, whichever costs most.
+ *
+ *  @param   operation [in] : Kernel: MEM_STATS_COMPARE, MEM_STATS_COPY or MEM_STATS_FILL.
+ *  @param   size      [in] : Size of the call in bytes.
+ *  @param   alignment [in] : Alignment class of the pointers. Fills only have one pointer, so MISALIGNED
+ *                            is treated as CO_ALIGNED.
+ *
+ *  @return  uint32_t - Cycle bound, saturated at UINT32_MAX; UINT32_MAX for an unknown operation or class.
+ **/
+
+uint32_t MEM_cycleBound(MEM_stats_op_t operation, size_t size, MEM_stats_align_t alignment)
+{
+    const wcetKernel_t *kernel = NULL;
+    uint64_t bound = UINT64_MAX;
+    uint64_t head_bytes = 1u;
+
+    if (((uint32_t)operation >= (uint32_t)MEM_STATS_OP_COUNT)
+        || ((uint32_t)alignment >= (uint32_t)MEM_STATS_ALIGN_COUNT))
+    {
+        goto return_status;
+    }
+
+    kernel = &wcet_kernels[operation];
+
+    if ((operation == MEM_STATS_FILL) && (alignment == MEM_STATS_MISALIGNED))
+    {
+        alignment = MEM_STATS_CO_ALIGNED;
+    }
+
+    if ((kernel->word == 0u) || (alignment == MEM_STATS_MISALIGNED))
+    {
+        bound = (uint64_t)kernel->setup + ((uint64_t)size * kernel->byte);
+    }
+    else if ((alignment == MEM_STATS_ALIGNED) || (size == 0u))
+    {
+        bound = wcetAligned(kernel, (uint64_t)size, 0u);
+    }
+    else
+    {
+        bound = 0u;
+
+        for (head_bytes = 1u; (head_bytes <= 3u) && (head_bytes <= (uint64_t)size); ++head_bytes)
+        {
+            const uint64_t cost = wcetAligned(kernel, (uint64_t)size, head_bytes);
+
+            if (cost > bound)
+            {
+                bound = cost;
+            }
+        }
+    }
+
+return_status:
+    return (bound > (uint64_t)UINT32_MAX) ? UINT32_MAX : (uint32_t)bound;
+}
+
+/*** end of file ***/